@@ -61,6 +61,8 @@ private:
   ScalarFieldType* avgTime_;
   ScalarFieldType* avgMdot_;
   VectorFieldType* forcingComp_;
+  VectorFieldType* forcingBasis_;
+  ScalarFieldType* forcingCoeff_;
 
   FieldUpdateAlgDriver metricTensorAlgDriver_;
   std::unique_ptr<SSTAMSAveragesAlg> avgAlg_;
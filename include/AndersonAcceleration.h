@@ -0,0 +1,173 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef AndersonAcceleration_h
+#define AndersonAcceleration_h
+
+#include "ngp_utils/NgpReduceUtils.h"
+
+#include <string>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+class Part;
+typedef std::vector<Part*> PartVector;
+} // namespace mesh
+} // namespace stk
+
+namespace YAML {
+class Node;
+}
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+class EquationSystems;
+
+namespace anderson {
+
+//! Maximum number of previous iterates retained in the history
+static constexpr int maxDepth = 5;
+
+//! Number of unique entries of the (symmetric) least-squares Gram matrix
+static constexpr int numGramEntries = maxDepth * (maxDepth + 1) / 2;
+
+//! Gram matrix, least-squares RHS and residual norm reduced in a single pass
+static constexpr int reduceSize = numGramEntries + maxDepth + 1;
+
+using ReduceArray = nalu_ngp::NgpReduceArray<double, reduceSize>;
+
+//! Position of entry (i, j), i <= j, in the packed upper triangle
+KOKKOS_INLINE_FUNCTION
+int
+gram_index(const int i, const int j)
+{
+  return j * (j + 1) / 2 + i;
+}
+
+/** Mixing coefficients from the packed least-squares normal equations
+ *
+ *  @param n Number of history columns
+ *  @param gram Gram matrix of the residual differences, see gram_index
+ *  @param rhs Projections of the latest residual on the residual differences
+ *  @param gamma Mixing coefficients of the history columns
+ */
+void solve_least_squares(
+  const int n,
+  const std::vector<double>& gram,
+  const std::vector<double>& rhs,
+  std::vector<double>& gamma);
+
+} // namespace anderson
+
+/** Anderson acceleration of the outer (Picard) iterations
+ *
+ *  The outer iterations over EquationSystems::solve_and_update define a
+ *  fixed-point map \f$x_{k+1} = G(x_k)\f$ acting on the stacked vector of
+ *  solution fields (velocity, pressure, transported scalars). This class keeps
+ *  a short history of the differences of iterates and residuals \f$f_k = G(x_k)
+ *  - x_k\f$ in nodal fields (i.e., on device) and replaces the plain update by
+ *  the Anderson mixing of the last `depth` iterates.
+ *
+ *  The residual blocks of the individual fields are scaled by the norm of the
+ *  first outer-iteration residual of the time step so that fields of different
+ *  magnitudes contribute equally to the least-squares problem. The history is
+ *  restarted whenever the maximum scaled nonlinear residual of the equation
+ *  systems grows by more than `restart_factor` between outer iterations.
+ */
+class AndersonAcceleration
+{
+public:
+  AndersonAcceleration(Realm& realm, const YAML::Node& node);
+
+  ~AndersonAcceleration() = default;
+
+  //! Register the history fields for all the accelerated solution fields
+  void register_nodal_fields(const stk::mesh::PartVector& part_vec);
+
+  //! Clear the history at the beginning of a time step
+  void reset();
+
+  //! Capture the iterate before the first outer iteration of a time step
+  void begin_iteration();
+
+  /** Replace the latest iterate with the Anderson mixed update
+   *
+   *  @param systemNorm Maximum scaled nonlinear residual of all equation
+   *  systems in the current outer iteration
+   */
+  void accelerate(const double systemNorm);
+
+private:
+  AndersonAcceleration() = delete;
+  AndersonAcceleration(const AndersonAcceleration&) = delete;
+
+  void load(const YAML::Node&);
+
+  Realm& realm_;
+
+  //! Names of the solution fields that are stacked in the acceleration vector
+  std::vector<std::string> fieldNames_;
+
+  //! Solution fields and their history fields
+  std::vector<stk::mesh::FieldBase*> fields_;
+  std::vector<stk::mesh::FieldBase*> histFields_;
+  std::vector<int> numComps_;
+
+  //! Scaling of the residual blocks of each field
+  std::vector<double> blockWeights_;
+
+  //! Number of previous iterates used in the least-squares problem
+  int depth_{3};
+
+  //! Relaxation (mixing) parameter applied to the residual
+  double relaxation_{1.0};
+
+  //! Growth of the nonlinear residual that triggers a history restart
+  double restartFactor_{2.0};
+
+  //! Number of outer iterations processed in the current time step
+  int iterCount_{0};
+
+  //! Number of valid history columns
+  int numHist_{0};
+
+  //! Circular buffer position of the next history column
+  int nextCol_{0};
+
+  double prevSystemNorm_{0.0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+namespace Kokkos {
+
+template <>
+struct reduction_identity<sierra::nalu::anderson::ReduceArray>
+{
+  KOKKOS_FORCEINLINE_FUNCTION
+  static sierra::nalu::anderson::ReduceArray sum()
+  {
+    return sierra::nalu::anderson::ReduceArray(0.0);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static sierra::nalu::anderson::ReduceArray prod()
+  {
+    return sierra::nalu::anderson::ReduceArray(1.0);
+  }
+};
+
+} // namespace Kokkos
+
+#endif /* AndersonAcceleration_h */
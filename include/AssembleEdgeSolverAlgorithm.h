@@ -67,8 +67,6 @@ public:
 
     auto coeffApplier = coeff_applier();
 
-    const auto nodesPerEntity = nodesPerEntity_;
-
     Kokkos::parallel_for(
       team_exec, KOKKOS_LAMBDA(const DeviceTeamHandleType& team) {
         auto bktId = buckets.device_get(team.league_rank());
@@ -91,8 +89,8 @@ public:
 
             lambdaFunc(smdata, edgeIndex, nodeL, nodeR);
 
-            coeffApplier(
-              nodesPerEntity, smdata.ngpElemNodes, smdata.scratchIds,
+            coeffApplier.sum_into_edge(
+              edgeIndex, smdata.ngpElemNodes, smdata.scratchIds,
               smdata.sortPermutation, smdata.rhs, smdata.lhs, __FILE__);
           });
       });
@@ -13,6 +13,7 @@
 #include <Realm.h>
 #include <SolverAlgorithm.h>
 #include <KokkosInterface.h>
+#include <NGPInstance.h>
 #include <SimdInterface.h>
 #include <ScratchViews.h>
 #include <SharedMemData.h>
@@ -56,7 +57,8 @@ public:
 
     const stk::mesh::NgpMesh& ngpMesh = realm_.ngp_mesh();
     const nalu_ngp::FieldManager& fieldMgr = realm_.ngp_field_manager();
-    ElemDataRequestsGPU dataNeededNGP(fieldMgr, dataNeededByKernels_);
+    const ElemDataRequestsGPU& dataNeededNGP =
+      dataNeededNGP_.get(bulk_data, fieldMgr, dataNeededByKernels_);
 
     const auto reqType = (entityRank_ == stk::topology::ELEM_RANK)
                            ? ElemReqType::ELEM
@@ -133,6 +135,10 @@ public:
   ElemDataRequests dataNeededByKernels_;
   stk::mesh::EntityRank entityRank_;
 
+  //! Device data reused across executions
+  ElemDataRequestsGPUCache dataNeededNGP_;
+  nalu_ngp::NGPKernelView<Kernel> ngpKernels_;
+
   //! Relaxation factor to be applied to the diagonal term
   double diagRelaxFactor_{1.0};
   unsigned nodesPerEntity_;
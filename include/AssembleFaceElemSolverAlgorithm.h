@@ -12,6 +12,7 @@
 
 #include <SolverAlgorithm.h>
 #include <ElemDataRequests.h>
+#include <NGPInstance.h>
 #include <Realm.h>
 #include <ScratchViews.h>
 #include <SimdInterface.h>
@@ -59,8 +60,10 @@ public:
 
     const stk::mesh::NgpMesh& ngpMesh = realm_.ngp_mesh();
     const nalu_ngp::FieldManager& fieldMgr = realm_.ngp_field_manager();
-    ElemDataRequestsGPU faceDataNGP(fieldMgr, faceDataNeeded_);
-    ElemDataRequestsGPU elemDataNGP(fieldMgr, elemDataNeeded_);
+    const ElemDataRequestsGPU& faceDataNGP =
+      faceDataNGP_.get(bulk, fieldMgr, faceDataNeeded_);
+    const ElemDataRequestsGPU& elemDataNGP =
+      elemDataNGP_.get(bulk, fieldMgr, elemDataNeeded_);
 
     const int bytes_per_team = 0;
     const int bytes_per_thread = calculate_shared_mem_bytes_per_thread(
@@ -163,6 +166,11 @@ public:
 
   ElemDataRequests faceDataNeeded_;
   ElemDataRequests elemDataNeeded_;
+
+  //! Device data reused across executions
+  ElemDataRequestsGPUCache faceDataNGP_;
+  ElemDataRequestsGPUCache elemDataNGP_;
+  nalu_ngp::NGPKernelView<Kernel> ngpKernels_;
   double diagRelaxFactor_{1.0};
   unsigned numDof_;
   unsigned nodesPerFace_;
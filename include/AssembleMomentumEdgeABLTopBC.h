@@ -95,11 +95,11 @@ public:
    * upper boundary.
    */
   virtual void potentialBCPeriodicPeriodic(
-    std::vector<double>& wSamp,
-    std::vector<double>& UAvg,
-    std::vector<double>& uBC,
-    std::vector<double>& vBC,
-    std::vector<double>& wBC);
+    double* wSamp,
+    const double* UAvg,
+    double* uBC,
+    double* vBC,
+    double* wBC);
 
   /** Solves the potential flow problem for inflow-periodic conditions
    * in x and y.
@@ -115,11 +115,11 @@ public:
    * upper boundary.
    */
   virtual void potentialBCInflowPeriodic(
-    std::vector<double>& wSamp,
-    std::vector<double>& UAvg,
-    std::vector<double>& uBC,
-    std::vector<double>& vBC,
-    std::vector<double>& wBC);
+    double* wSamp,
+    const double* UAvg,
+    double* uBC,
+    double* vBC,
+    double* wBC);
 
   /** Solves the potential flow problem for inflow-inflow conditions
    * in x and y.
@@ -135,11 +135,11 @@ public:
    * upper boundary.
    */
   virtual void potentialBCInflowInflow(
-    std::vector<double>& wSamp,
-    std::vector<double>& UAvg,
-    std::vector<double>& uBC,
-    std::vector<double>& vBC,
-    std::vector<double>& wBC);
+    double* wSamp,
+    const double* UAvg,
+    double* uBC,
+    double* vBC,
+    double* wBC);
 
   /** Class variable definitions.
    */
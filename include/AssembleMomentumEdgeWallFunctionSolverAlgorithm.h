@@ -1,52 +0,0 @@
-// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
-// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
-// Northwest Research Associates. Under the terms of Contract DE-NA0003525
-// with NTESS, the U.S. Government retains certain rights in this software.
-//
-// This software is released under the BSD 3-clause license. See LICENSE file
-// for more details.
-//
-
-#ifndef AssembleMomentumEdgeWallFunctionSolverAlgorithm_h
-#define AssembleMomentumEdgeWallFunctionSolverAlgorithm_h
-
-#include <SolverAlgorithm.h>
-#include <FieldTypeDef.h>
-
-namespace stk {
-namespace mesh {
-class Part;
-}
-} // namespace stk
-
-namespace sierra {
-namespace nalu {
-
-class Realm;
-
-class AssembleMomentumEdgeWallFunctionSolverAlgorithm : public SolverAlgorithm
-{
-public:
-  AssembleMomentumEdgeWallFunctionSolverAlgorithm(
-    Realm& realm, stk::mesh::Part* part, EquationSystem* eqSystem);
-  virtual ~AssembleMomentumEdgeWallFunctionSolverAlgorithm() {}
-  virtual void initialize_connectivity();
-  virtual void execute();
-
-  const double yplusCrit_;
-  const double elog_;
-  const double kappa_;
-
-  VectorFieldType* velocity_;
-  VectorFieldType* bcVelocity_;
-  ScalarFieldType* density_;
-  ScalarFieldType* viscosity_;
-  GenericFieldType* exposedAreaVec_;
-  GenericFieldType* wallFrictionVelocityBip_;
-  GenericFieldType* wallNormalDistanceBip_;
-};
-
-} // namespace nalu
-} // namespace sierra
-
-#endif
@@ -11,6 +11,7 @@
 #define ASSEMBLENGPNODESOLVERALGORITHM_H
 
 #include "SolverAlgorithm.h"
+#include "NGPInstance.h"
 
 #include <vector>
 #include <memory>
@@ -55,6 +56,9 @@ private:
   //! List of NodeKernels registered with this algorithm
   NodeKernelVecType nodeKernels_;
 
+  //! Device view of the kernels; rebuilt only when the kernel list changes
+  nalu_ngp::NGPKernelView<NodeKernel> ngpKernels_;
+
   //! Number of DOFs per nodal entity
   const int rhsSize_;
 };
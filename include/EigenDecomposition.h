@@ -69,7 +69,7 @@ sym_diagonalize(const T (&A)[2][2], T (&Q)[2][2], T (&D)[2][2])
 //-------- matrix_matrix_multiply 2D ---------------------------------------
 //--------------------------------------------------------------------------
 template <class T>
-void
+KOKKOS_FUNCTION void
 matrix_matrix_multiply(const T (&A)[2][2], const T (&B)[2][2], T (&C)[2][2])
 {
   // C = A*B
@@ -88,7 +88,7 @@ matrix_matrix_multiply(const T (&A)[2][2], const T (&B)[2][2], T (&C)[2][2])
 //-------- reconstruct_matrix_from_decomposition 2D ------------------------
 //--------------------------------------------------------------------------
 template <class T>
-void
+KOKKOS_FUNCTION void
 reconstruct_matrix_from_decomposition(
   const T (&D)[2][2], const T (&Q)[2][2], T (&A)[2][2])
 {
@@ -250,11 +250,90 @@ sym_diagonalize(const T (&A)[3][3], T (&Q)[3][3], T (&D)[3][3])
   }
 }
 
+//--------------------------------------------------------------------------
+//-------- jacobi symmetric diagonalize (3D) -------------------------------
+//--------------------------------------------------------------------------
+template <class T>
+KOKKOS_FUNCTION void
+jacobi_sym_diagonalize(
+  const T (&A)[3][3], T (&Q)[3][3], T (&D)[3][3], const int numSweeps = 5)
+{
+  /*
+    Cyclic Jacobi rotations with a fixed number of sweeps; no data dependent
+    branches, i.e., suited for SIMD types and device code.
+
+    A must be a symmetric matrix.
+    returns Q and D such that
+    Diagonal matrix D = QT * A * Q;  and  A = Q*D*QT
+  */
+
+  const T small = 1.0e-300;
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      D[i][j] = A[i][j];
+      Q[i][j] = (i == j) ? 1.0 : 0.0;
+    }
+  }
+
+  for (int sweep = 0; sweep < numSweeps; ++sweep) {
+    for (int p = 0; p < 2; ++p) {
+      for (int q = p + 1; q < 3; ++q) {
+        // remaining index
+        const int r = 3 - p - q;
+
+        const T apq = D[p][q];
+        const auto active = stk::math::abs(apq) > small;
+
+        // rotation angle; tan computed as sign(T)/(|T|+sqrt(T^2+1))
+        const T thet = (D[q][q] - D[p][p]) /
+                       (2.0 * stk::math::if_then_else(active, apq, 1.0));
+        const T sgn = stk::math::if_then_else(thet < 0.0, -1.0, 1.0);
+        const T athet = stk::math::abs(thet);
+        const T t = stk::math::if_then_else(
+          active,
+          stk::math::if_then_else(
+            athet < 1.0e6, sgn / (athet + stk::math::sqrt(athet * athet + 1.0)),
+            0.5 * sgn / athet),
+          0.0);
+        const T c = 1.0 / stk::math::sqrt(t * t + 1.0);
+        const T s = t * c;
+
+        // D = JT * D * J
+        const T arp = D[r][p];
+        const T arq = D[r][q];
+        D[p][p] = D[p][p] - t * apq;
+        D[q][q] = D[q][q] + t * apq;
+        D[p][q] = 0.0;
+        D[q][p] = 0.0;
+        D[r][p] = c * arp - s * arq;
+        D[p][r] = D[r][p];
+        D[r][q] = s * arp + c * arq;
+        D[q][r] = D[r][q];
+
+        // Q = Q * J
+        for (int k = 0; k < 3; ++k) {
+          const T qkp = Q[k][p];
+          const T qkq = Q[k][q];
+          Q[k][p] = c * qkp - s * qkq;
+          Q[k][q] = s * qkp + c * qkq;
+        }
+      }
+    }
+  }
+
+  // drop the remaining off-diagonal round-off
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j)
+      if (i != j)
+        D[i][j] = 0.0;
+}
+
 //--------------------------------------------------------------------------
 //-------- matrix_matrix_multiply 3D ---------------------------------------
 //--------------------------------------------------------------------------
 template <class T>
-void
+KOKKOS_FUNCTION void
 matrix_matrix_multiply(const T (&A)[3][3], const T (&B)[3][3], T (&C)[3][3])
 {
   // C = A*B
@@ -273,7 +352,7 @@ matrix_matrix_multiply(const T (&A)[3][3], const T (&B)[3][3], T (&C)[3][3])
 //-------- reconstruct_matrix_from_decomposition 3D ------------------------
 //--------------------------------------------------------------------------
 template <class T>
-void
+KOKKOS_FUNCTION void
 reconstruct_matrix_from_decomposition(
   const T (&D)[3][3], const T (&Q)[3][3], T (&A)[3][3])
 {
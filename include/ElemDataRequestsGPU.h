@@ -14,12 +14,15 @@
 #include <Kokkos_Core.hpp>
 #include <ElemDataRequests.h>
 #include <FieldTypeDef.h>
+#include <stk_mesh/base/BulkData.hpp>
 #include <stk_mesh/base/Ngp.hpp>
 #include <stk_mesh/base/GetNgpField.hpp>
 #include <ngp_utils/NgpFieldManager.h>
 #include <FieldManager.h>
 #include "master_element/MasterElementRepo.h"
 
+#include <memory>
+
 namespace sierra {
 namespace nalu {
 
@@ -279,6 +282,7 @@ ElemDataRequestsGPU::fill_host_coords_fields(
 #endif
   coordsFieldsTypes_ =
     CoordsTypesView("CoordsFieldsTypes", dataReq.get_coordinates_map().size());
+  ngp_device_allocation_count() += 2;
 
   hostCoordsFields_ = Kokkos::create_mirror_view(coordsFields_);
   hostCoordsFieldsTypes_ = Kokkos::create_mirror_view(coordsFieldsTypes_);
@@ -315,6 +319,7 @@ ElemDataRequestsGPU::fill_host_fields(
 #else
   fields = FieldInfoView("Fields", dataReq.get_fields().size());
 #endif
+  ++ngp_device_allocation_count();
   hostFields = Kokkos::create_mirror_view(fields);
   unsigned i = 0;
   for (const FieldInfo& finfo : dataReq.get_fields()) {
@@ -323,6 +328,34 @@ ElemDataRequestsGPU::fill_host_fields(
       FieldInfoType(fld_ptr, finfo.scalarsDim1, finfo.scalarsDim2);
   }
 }
+
+/** Device copy of element data requests reused across algorithm executions
+ *
+ *  The views are rebuilt only after the mesh has been modified, i.e., when the
+ *  NGP fields referenced by the requests might have been reallocated.
+ */
+class ElemDataRequestsGPUCache
+{
+public:
+  template <typename T>
+  const ElemDataRequestsGPU& get(
+    const stk::mesh::BulkData& bulk,
+    const T& fieldMgr,
+    const ElemDataRequests& dataReq)
+  {
+    const size_t syncCount = bulk.synchronized_count();
+    if (!dataReqNGP_ || (syncCount != syncCount_)) {
+      dataReqNGP_.reset(new ElemDataRequestsGPU(fieldMgr, dataReq));
+      syncCount_ = syncCount;
+    }
+    return *dataReqNGP_;
+  }
+
+private:
+  std::unique_ptr<ElemDataRequestsGPU> dataReqNGP_;
+  size_t syncCount_{0};
+};
+
 } // namespace nalu
 } // namespace sierra
 
@@ -18,6 +18,7 @@
 
 #include "ngp_algorithms/NodalGradAlgDriver.h"
 #include "ngp_algorithms/EnthalpyEffDiffFluxCoeffAlg.h"
+#include "ngp_algorithms/WallHeatTransferAlgDriver.h"
 
 namespace stk {
 struct topology;
@@ -28,7 +29,6 @@ namespace nalu {
 
 class AlgorithmDriver;
 class Realm;
-class AssembleWallHeatTransferAlgorithmDriver;
 class LinearSystem;
 class EquationSystems;
 class ProjectedNodalGradientEquationSystem;
@@ -126,7 +126,7 @@ public:
 
   ScalarNodalGradAlgDriver nodalGradAlgDriver_;
   std::unique_ptr<EnthalpyEffDiffFluxCoeffAlg> diffFluxCoeffAlg_;
-  AssembleWallHeatTransferAlgorithmDriver* assembleWallHeatTransferAlgDriver_;
+  std::unique_ptr<WallHeatTransferAlgDriver> wallHeatTransferAlgDriver_;
 
   bool pmrCouplingActive_;
   bool lowSpeedCompressActive_;
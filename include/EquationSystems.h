@@ -41,6 +41,7 @@ class EquationSystem;
 class Simulation;
 class AlgorithmDriver;
 class UpdateOversetFringeAlgorithmDriver;
+class AndersonAcceleration;
 
 typedef std::vector<EquationSystem*> EquationSystemVector;
 
@@ -196,6 +197,9 @@ public:
 
   std::unique_ptr<UpdateOversetFringeAlgorithmDriver> oversetUpdater_;
 
+  //! Optional Anderson acceleration of the outer iterations
+  std::unique_ptr<AndersonAcceleration> andersonAccel_;
+
   /** Default number of overset coupling iterations
    *
    *  This parameter controls the global settings for _decoupled overset_
@@ -98,6 +98,10 @@ using PeriodicNodeMapHost = PeriodicNodeMap::HostMirror;
  *  linear system. The HypreLinearSystem::solve method interfaces with
  *  sierra::nalu::HypreDirectSolver that is responsible for the actual solution
  *  of the system using the required solver and preconditioner combination.
+ *
+ *  Edge assembly does not use a precomputed offset table here: each
+ *  contribution still locates its columns by walking the sorted row, as for
+ *  element assembly.
  */
 class HypreLinearSystem : public LinearSystem
 {
@@ -270,6 +274,13 @@ public:
     const unsigned beginPos,
     const unsigned endPos);
 
+  /** Populate the Dirichlet rows of all the queued conditions at once
+   */
+  virtual void applyQueuedDirichletBCs();
+
+  //! Apply a batch of Dirichlet conditions using the precomputed rows
+  void apply_dirichlet_rows(const std::vector<DirichletBCRequest>& requests);
+
   sierra::nalu::CoeffApplier* get_coeff_applier();
 
   // print timings for initialize
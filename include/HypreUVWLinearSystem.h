@@ -76,6 +76,13 @@ public:
     const unsigned beginPos,
     const unsigned endPos);
 
+  /** Apply the queued Dirichlet conditions one at a time
+   */
+  virtual void applyQueuedDirichletBCs()
+  {
+    LinearSystem::applyQueuedDirichletBCs();
+  }
+
   virtual unsigned numDof() const { return nDim_; }
 
   sierra::nalu::CoeffApplier* get_coeff_applier();
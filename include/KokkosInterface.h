@@ -235,10 +235,23 @@ kokkos_parallel_reduce(
     reduce);
 }
 
+/** Number of device allocations performed by the NGP helpers
+ *
+ *  Algorithms reuse their device instances and views across time steps, i.e.,
+ *  the count should not change during steady-state time steps.
+ */
+inline size_t&
+ngp_device_allocation_count()
+{
+  static size_t count = 0;
+  return count;
+}
+
 template <typename T, typename MemorySpace = MemSpace>
 inline T*
 kokkos_malloc_on_device(const std::string& debuggingName)
 {
+  ++ngp_device_allocation_count();
   return static_cast<T*>(
     Kokkos::kokkos_malloc<MemorySpace>(debuggingName, sizeof(T)));
 }
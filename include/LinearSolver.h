@@ -191,6 +191,7 @@ protected:
   bool reusePreconditioner_;
   double timerPrecond_;
   bool activateMueLu_{false};
+  bool holdPreconditioner_{false};
 
 public:
   //! Flag indicating whether the preconditioner is recomputed on each
@@ -199,6 +200,10 @@ public:
   //! Flag indicating whether the preconditioner is reused on each invocation
   bool& reusePreconditioner() { return reusePreconditioner_; }
 
+  //! Flag indicating whether the current preconditioner is kept as is for
+  //! subsequent solves, irrespective of the recompute/reuse settings
+  bool& holdPreconditioner() { return holdPreconditioner_; }
+
   //! Reset the preconditioner timer to 0.0 for future accumulation
   void zero_timer_precond() { timerPrecond_ = 0.0; }
 
@@ -271,6 +276,12 @@ public:
     return (config_->useSegregatedSolver() ? PT_TPETRA_SEGREGATED : PT_TPETRA);
   }
 
+  //! Number of times the Ifpack2 preconditioner has been computed
+  int num_preconditioner_computes() const
+  {
+    return preconditioner_.is_null() ? 0 : preconditioner_->getNumCompute();
+  }
+
 private:
   //! The solver parameters
   const Teuchos::RCP<Teuchos::ParameterList> params_;
@@ -12,10 +12,14 @@
 
 #include <LinearSolverTypes.h>
 #include <KokkosInterface.h>
+#include <FieldTypeDef.h>
 
 #include <stk_mesh/base/Ngp.hpp>
 #include <stk_mesh/base/NgpMesh.hpp>
+#include <stk_mesh/base/Selector.hpp>
 
+#include <functional>
+#include <map>
 #include <vector>
 #include <string>
 
@@ -69,6 +73,26 @@ public:
     const SharedMemView<const double**, DeviceShmem>& lhs,
     const char* trace_tag) = 0;
 
+  /** Sum the contributions of a single edge into the system
+   *
+   *  Linear systems that tabulate where the edge stencils live in the matrix
+   *  override this to scatter directly instead of sorting and searching.
+   *  Only the monolithic TpetraLinearSystem does so; HypreLinearSystem and
+   *  the segregated Tpetra system use this search-based default.
+   */
+  KOKKOS_FUNCTION
+  virtual void sum_into_edge(
+    const stk::mesh::FastMeshIndex& /* edgeIndex */,
+    const stk::mesh::NgpMesh::ConnectedNodes& edgeNodes,
+    const SharedMemView<int*, DeviceShmem>& localIds,
+    const SharedMemView<int*, DeviceShmem>& sortPermutation,
+    const SharedMemView<const double*, DeviceShmem>& rhs,
+    const SharedMemView<const double**, DeviceShmem>& lhs,
+    const char* trace_tag)
+  {
+    (*this)(2, edgeNodes, localIds, sortPermutation, rhs, lhs, trace_tag);
+  }
+
   virtual void free_device_pointer() = 0;
   virtual CoeffApplier* device_pointer() = 0;
 };
@@ -85,6 +109,39 @@ struct CoeffApplierDestructor
   }
 };
 
+/** Dirichlet rows precomputed for a batch of boundary conditions
+ *
+ *  Holds one entry per matrix row so that all the conditions of an equation
+ *  can be applied by a single flat kernel without traversing buckets. When
+ *  several conditions act on the same row only the last one registered is
+ *  kept, which matches the result of applying them one after the other.
+ */
+struct DirichletRows
+{
+  //! Maximum number of conditions whose fields are passed to one kernel
+  static constexpr int maxBatchSize = 8;
+
+  //! Node of the row
+  Kokkos::View<stk::mesh::FastMeshIndex*, LinSysMemSpace> meshIdx;
+  //! Local row id within the linear system
+  Kokkos::View<int*, LinSysMemSpace> rowId;
+  //! Component of the solution field for this row
+  Kokkos::View<int*, LinSysMemSpace> comp;
+  //! Index of the condition (within its batch) providing the BC value
+  Kokkos::View<int*, LinSysMemSpace> bcIndex;
+
+  //! Range of entries belonging to each batch of maxBatchSize conditions
+  std::vector<size_t> batchOffsets;
+};
+
+/** Solution and BC value fields of one batch of Dirichlet conditions
+ */
+struct DirichletBCFields
+{
+  NGPDoubleFieldType solution[DirichletRows::maxBatchSize];
+  NGPDoubleFieldType bcValues[DirichletRows::maxBatchSize];
+};
+
 class LinearSystem
 {
 public:
@@ -179,6 +236,25 @@ public:
     const unsigned beginPos,
     const unsigned endPos) = 0;
 
+  /** Register a Dirichlet condition to be applied by applyQueuedDirichletBCs
+   *
+   *  Conditions queued during assembly are applied together once all the
+   *  other contributions have been summed into the system.
+   */
+  void queueDirichletBCs(
+    stk::mesh::FieldBase* solutionField,
+    stk::mesh::FieldBase* bcValuesField,
+    const stk::mesh::PartVector& parts,
+    const unsigned beginPos,
+    const unsigned endPos);
+
+  /** Apply and clear all the queued Dirichlet conditions
+   *
+   *  The default implementation applies the conditions one at a time through
+   *  applyDirichletBCs.
+   */
+  virtual void applyQueuedDirichletBCs();
+
   /** Reset LHS and RHS for the given set of nodes to 0
    *
    *  @param nodeList A list of STK node entities whose rows are zeroed out
@@ -226,6 +302,8 @@ public:
 
   EquationSystem* equationSystem() { return eqSys_; }
 
+  LinearSolver* linearSolver() { return linearSolver_; }
+
 protected:
   virtual void beginLinearSystemConstruction() = 0;
   virtual void checkError(const int err_code, const char* msg) = 0;
@@ -233,6 +311,43 @@ protected:
   void sync_field(const stk::mesh::FieldBase* field);
   bool debug();
 
+  struct DirichletBCRequest
+  {
+    stk::mesh::FieldBase* solutionField;
+    stk::mesh::FieldBase* bcValuesField;
+    stk::mesh::PartVector parts;
+    unsigned beginPos;
+    unsigned endPos;
+  };
+
+  /** Return the rows of the given Dirichlet conditions
+   *
+   *  The rows are gathered from the mesh the first time a given set of
+   *  conditions and node selector is requested after the graph has been
+   *  built or the mesh has been modified, and reused afterwards.
+   *
+   *  @param requests Conditions in the order they are to be applied
+   *  @param sel Nodes eligible for the conditions (owned and/or shared)
+   *  @param nodeRowOffset Local row id of the first DOF of a node
+   */
+  const DirichletRows& dirichlet_rows(
+    const std::vector<DirichletBCRequest>& requests,
+    const stk::mesh::Selector& sel,
+    const std::function<int(stk::mesh::Entity)>& nodeRowOffset);
+
+  /** Sync the fields of one batch of conditions to device
+   */
+  DirichletBCFields dirichlet_bc_fields(
+    const std::vector<DirichletBCRequest>& requests, const size_t batch);
+
+  //! Discard the precomputed Dirichlet rows when the graph is rebuilt
+  void clear_dirichlet_rows() { dirichletRows_.clear(); }
+
+  std::vector<DirichletBCRequest> dirichletQueue_;
+  std::map<std::string, DirichletRows> dirichletRows_;
+  //! Mesh modification count the precomputed Dirichlet rows belong to
+  size_t dirichletRowsSyncCount_{0};
+
   Realm& realm_;
   EquationSystem* eqSys_;
   bool inConstruction_;
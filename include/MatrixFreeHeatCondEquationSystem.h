@@ -75,6 +75,7 @@ private:
   stk::mesh::MetaData& meta_;
 
   stk::mesh::Selector interior_selector_;
+  bool has_dense_topologies_{false};
   stk::mesh::Selector dirichlet_selector_;
   stk::mesh::Selector flux_selector_;
 
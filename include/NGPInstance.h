@@ -13,6 +13,7 @@
 #include "KokkosInterface.h"
 
 #include <type_traits>
+#include <vector>
 
 namespace sierra {
 namespace nalu {
@@ -62,6 +63,26 @@ create(Args&&... args)
   return obj;
 }
 
+/** Update a device instance in place with a copy of the host object
+ *
+ *  The device memory of the instance is reused, i.e., no allocation takes
+ *  place.
+ */
+template <class T>
+inline void
+recreate(T* obj, const T& hostObj)
+{
+  const std::string debuggingName(typeid(T).name());
+
+  // Create local copy for capture on device
+  const T hostCopy(hostObj);
+  Kokkos::parallel_for(
+    debuggingName, DeviceRangePolicy(0, 1), KOKKOS_LAMBDA(const int) {
+      obj->~T();
+      new (obj) T(hostCopy);
+    });
+}
+
 template <typename T>
 inline void
 destroy(T* obj)
@@ -118,6 +139,7 @@ create_ngp_view(const Container& hostVec)
   const std::string clsName(typeid(T).name());
   const std::string debuggingName = "NGP" + clsName + "View";
   NGPInfoView ngpVec(debuggingName, numObjects);
+  ++ngp_device_allocation_count();
 
   typename NGPInfoView::HostMirror hostNgpView =
     Kokkos::create_mirror_view(ngpVec);
@@ -130,6 +152,52 @@ create_ngp_view(const Container& hostVec)
   return ngpVec;
 }
 
+/** Kokkos::View of device instances that persists across executions
+ *
+ *  The device instances are updated in place by `create_on_device`, so the
+ *  view only needs to be rebuilt when the list of instances changes.
+ */
+template <typename T>
+class NGPKernelView
+{
+public:
+  using NGPInfo = NGPCopyHolder<T>;
+  using NGPInfoView = Kokkos::View<NGPInfo*, Kokkos::LayoutRight, MemSpace>;
+
+  /** Update the device instances and return the view of their pointers
+   */
+  template <typename Container>
+  const NGPInfoView& update(const Container& hostVec)
+  {
+    const size_t numObjects = hostVec.size();
+    bool changed = (numObjects != devicePtrs_.size());
+    devicePtrs_.resize(numObjects, nullptr);
+    for (size_t i = 0; i < numObjects; ++i) {
+      T* ptr = hostVec[i]->create_on_device();
+      changed = changed || (ptr != devicePtrs_[i]);
+      devicePtrs_[i] = ptr;
+    }
+
+    if (changed) {
+      const std::string clsName(typeid(T).name());
+      ngpVec_ = NGPInfoView("NGP" + clsName + "View", numObjects);
+      ++ngp_device_allocation_count();
+
+      typename NGPInfoView::HostMirror hostNgpView =
+        Kokkos::create_mirror_view(ngpVec_);
+      for (size_t i = 0; i < numObjects; ++i)
+        hostNgpView(i) = NGPInfo(devicePtrs_[i]);
+      Kokkos::deep_copy(ngpVec_, hostNgpView);
+    }
+
+    return ngpVec_;
+  }
+
+private:
+  NGPInfoView ngpVec_;
+  std::vector<T*> devicePtrs_;
+};
+
 } // namespace nalu_ngp
 
 } // namespace nalu
@@ -78,6 +78,12 @@ public:
 
   void register_overset_bc();
 
+  //! Face algorithm closing the surface integral with the BC value of q
+  void register_boundary_algorithm(
+    stk::mesh::Part* part,
+    const std::string& bcName,
+    const std::string& bcQName);
+
   // internal solve and update from EquationSystems
   void solve_and_update();
 
@@ -106,6 +112,10 @@ public:
   // internal fields
   VectorFieldType* dqdx_;
   VectorFieldType* qTmp_;
+
+  // preconditioner of the (geometry-only) PNG matrix is up to date; the
+  // matrix itself is reassembled with the RHS, only the preconditioner is kept
+  bool precondIsCurrent_{false};
 };
 
 } // namespace nalu
@@ -26,6 +26,7 @@
 
 #include <ngp_utils/NgpFieldManager.h>
 #include "ngp_utils/NgpMeshInfo.h"
+#include "utils/HostScratchArena.h"
 
 #include "stk_mesh/base/NgpMesh.hpp"
 
@@ -77,6 +78,8 @@ class PropertyEvaluator;
 class Transfer;
 class MeshMotionAlg;
 class MeshTransformationAlg;
+class NodeAwareExchange;
+class TemporalErrorController;
 
 class SolutionNormPostProcessing;
 class SideWriterContainer;
@@ -180,6 +183,13 @@ public:
   void initialize_post_processing_algorithms();
 
   void compute_geometry();
+
+  /** Enable the rigid-motion geometry update if the configuration allows it
+   *
+   *  With purely rigid mesh motion the volumes are invariant and the area
+   *  vectors are rotated from the model configuration instead of recomputed.
+   */
+  void check_rigid_geometry_update();
   void compute_vrtm(const std::string& = "velocity");
   void compute_l2_scaling();
   void output_converged_results();
@@ -246,6 +256,9 @@ public:
     const unsigned nCols,
     const bool doFinalSyncToDevice = true);
 
+  //! Sum shared-node contributions; the fields are left modified on host
+  void ngp_parallel_sum(const std::vector<NGPDoubleFieldType*>& fields);
+
   virtual void populate_initial_condition();
   virtual void populate_boundary_data();
   virtual void boundary_data_to_state_data();
@@ -258,9 +271,26 @@ public:
   virtual void populate_derived_quantities();
   virtual void evaluate_properties();
   virtual double compute_adaptive_time_step();
+
+  //! Temporal error check of the latest step; true without error control
+  virtual bool accept_time_step();
+
+  //! Restore the StateNP1 fields from StateN to retry the latest step
+  virtual void reject_time_step();
+
   virtual void swap_states();
   virtual void predict_state();
   virtual void update_geometry_due_to_mesh_motion();
+
+  /** Advance the flow-driven rigid bodies of the mesh motion
+   *
+   *  Predicts the body motion at the first call of a time step and corrects
+   *  it with the loads of the latest flow iterate at subsequent calls.
+   */
+  void update_rigid_body_motion();
+
+  //! Rigid bodies are coupled implicitly through the nonlinear iterations
+  bool has_implicit_rigid_body_coupling() const;
   virtual void update_graph_connectivity_and_coordinates_due_to_mesh_motion();
   virtual void output_banner();
   virtual void advance_time_step();
@@ -355,6 +385,9 @@ public:
     return mesh_info().ngp_field_manager();
   }
 
+  //! Scratch memory for host-side algorithms of this realm
+  HostScratchPool& host_scratch() { return hostScratch_; }
+
   // inactive part
   stk::mesh::Selector get_inactive_selector();
 
@@ -457,6 +490,13 @@ public:
   bool hasOverset_;
   bool isExternalOverset_{false};
 
+  //! Rotate the geometry analytically instead of recomputing it for rigid
+  //! mesh motion
+  bool rigidGeometryUpdate_{false};
+
+  //! Time step count of the last rigid-body prediction
+  int rigidBodyStepCount_{-1};
+
   // three type of transfer operations
   bool hasMultiPhysicsTransfer_;
   bool hasInitializationTransfer_;
@@ -663,6 +703,15 @@ protected:
   std::unique_ptr<NgpMeshInfo> meshInfo_;
 
   unsigned meshModCount_{0};
+
+  HostScratchPool hostScratch_;
+
+  //! Shared-memory halo exchange, created if requested in the input file
+  std::unique_ptr<NodeAwareExchange> nodeAwareExchange_;
+
+  //! Error-controlled time stepping, created if requested in the input file
+  std::unique_ptr<TemporalErrorController> temporalErrorController_;
+
   const std::string allElementPartAlias{"all_blocks"};
 };
 
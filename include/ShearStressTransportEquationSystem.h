@@ -14,6 +14,11 @@
 #include <FieldTypeDef.h>
 #include <NaluParsedTypes.h>
 
+#include "ngp_algorithms/SSTMaxLengthScaleDriver.h"
+#include "utils/SSTUpdateAndClip.h"
+
+#include <memory>
+
 namespace stk {
 struct topology;
 namespace mesh {
@@ -25,7 +30,6 @@ namespace sierra {
 namespace nalu {
 
 class EquationSystems;
-class AlgorithmDriver;
 class TurbKineticEnergyEquationSystem;
 class SpecificDissipationRateEquationSystem;
 class GammaEquationSystem;
@@ -60,16 +64,7 @@ public:
   void clip_min_distance_to_wall();
   void compute_f_one_blending();
   void update_and_clip();
-  void update_and_clip_gamma();
-  void clip_sst(
-    const stk::mesh::NgpMesh& ngpMesh,
-    const stk::mesh::Selector& sel,
-    stk::mesh::NgpField<double>& tke,
-    stk::mesh::NgpField<double>& sdr);
-  void clip_sst_gamma(
-    const stk::mesh::NgpMesh& ngpMesh,
-    const stk::mesh::Selector& sel,
-    stk::mesh::NgpField<double>& gamma);
+  SSTClipLimits clip_limits() const;
 
   TurbKineticEnergyEquationSystem* tkeEqSys_;
   SpecificDissipationRateEquationSystem* sdrEqSys_;
@@ -83,7 +78,7 @@ public:
   ScalarFieldType* maxLengthScale_;
 
   bool isInit_;
-  AlgorithmDriver* sstMaxLengthScaleAlgDriver_;
+  std::unique_ptr<SSTMaxLengthScaleDriver> sstMaxLengthScaleAlgDriver_;
 
   // saved of mesh parts that are for wall bcs
   std::vector<stk::mesh::Part*> wallBcPart_;
@@ -167,6 +167,17 @@ public:
   double roughnessHeight_;
   bool RANSBelowKs_;
 
+  // shared-memory exchange of shared-node sums between ranks on a node
+  bool nodeAwareHaloExchange_;
+
+  // local (pseudo) time stepping for steady runs; Courant number ramped by
+  // switched evolution relaxation between the bounds
+  bool localTimeStepping_{false};
+  double localTimeStepCourant_{5.0};
+  double localTimeStepMinCourant_{1.0};
+  double localTimeStepMaxCourant_{1.0e3};
+  double localTimeStepSERExponent_{1.0};
+
   // turbulence model coeffs
   std::map<TurbulenceModelConstant, double> turbModelConstantMap_;
 
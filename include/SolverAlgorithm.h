@@ -49,6 +49,17 @@ struct NGPApplyCoeff
     SharedMemView<double**, DeviceShmem>& lhs,
     const char* trace_tag) const;
 
+  //! Edge variant; lets the linear system use its edge offset table
+  KOKKOS_FUNCTION
+  void sum_into_edge(
+    const stk::mesh::FastMeshIndex& edgeIndex,
+    const stk::mesh::NgpMesh::ConnectedNodes& edgeNodes,
+    const SharedMemView<int*, DeviceShmem>& scratchIds,
+    const SharedMemView<int*, DeviceShmem>& sortPermutation,
+    SharedMemView<double*, DeviceShmem>& rhs,
+    SharedMemView<double**, DeviceShmem>& lhs,
+    const char* trace_tag) const;
+
   KOKKOS_FUNCTION
   void extract_diagonal(
     const unsigned nEntities,
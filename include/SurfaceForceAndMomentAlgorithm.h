@@ -39,6 +39,19 @@ public:
 
   void cross_product(double* force, double* cross, double* rad);
 
+  /** Integrate the pressure and viscous forces over a set of surfaces
+   *
+   *  @param[in]  centroid    Point the moment is computed about
+   *  @param[out] forceMoment Global pressure force, viscous force and moment
+   *                          (nine values, as written to the output file)
+   */
+  static void compute_force_moment(
+    Realm& realm,
+    const stk::mesh::PartVector& partVec,
+    const double* centroid,
+    const bool useShifted,
+    double* forceMoment);
+
   const std::string& outputFileName_;
   const int& frequency_;
   const std::vector<double>& parameters_;
@@ -0,0 +1,146 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef TemporalErrorController_h
+#define TemporalErrorController_h
+
+#include <string>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+} // namespace stk
+
+namespace YAML {
+class Node;
+}
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+namespace temporal_error {
+
+//! Gains and limits of the PI step-size controller
+struct PIControlParams
+{
+  //! Integral and proportional gains, Gustafsson's 0.3/k and 0.4/k for k = 2
+  double kI{0.15};
+  double kP{0.2};
+
+  //! Exponent of the elementary controller retrying a rejected step
+  double kR{0.5};
+
+  //! Safety factor applied to every proposed step
+  double safety{0.9};
+
+  //! Bounds on the ratio of successive time steps
+  double minFactor{0.2};
+  double maxFactor{2.0};
+};
+
+/** Ratio of the next to the current time step
+ *
+ *  PI control of an accepted step with the scaled error estimates `err` and
+ *  `errPrev` of the current and previous steps (1 at tolerance); a rejected
+ *  step is retried with the integral part only.
+ */
+double step_factor(
+  const PIControlParams& params,
+  const double err,
+  const double errPrev,
+  const bool rejected);
+
+} // namespace temporal_error
+
+/** Time-step selection by an embedded estimate of the temporal error
+ *
+ *  The BDF2 solution \f$\phi^{n+1}\f$ and the backward Euler solution for the
+ *  same time derivative differ by
+ *  \f$(\gamma_1 - 1) \phi^{n+1} + (\gamma_2 + 1) \phi^n + \gamma_3
+ *  \phi^{n-1}\f$, which is the local truncation error of backward Euler and a
+ *  conservative estimate of the BDF2 error. Its weighted RMS norm, scaled by
+ *  `absolute_tolerance + relative_tolerance |phi|`, drives a PI step-size
+ *  controller. Steps with a scaled error above one are rejected and retried
+ *  with a smaller step from the `StateN` fields, unless `max_rejections`
+ *  retries of the step have already been made.
+ *
+ *  Until a BDF2 step is available (first step, restart) the Courant-based
+ *  controller of the realm is used. The step can optionally be capped by a
+ *  maximum Courant number.
+ */
+class TemporalErrorController
+{
+public:
+  TemporalErrorController(Realm& realm, const YAML::Node& node);
+
+  ~TemporalErrorController() = default;
+
+  //! Estimate the error of the latest step; false if the step is rejected
+  bool accept_time_step();
+
+  //! The latest step is retried, StateN fields are restored by the realm
+  void reject_time_step();
+
+  //! True once an error estimate of a BDF2 step is available
+  bool has_estimate() const { return haveEstimate_; }
+
+  //! Scaled error estimate of the latest step, one at tolerance
+  double scaled_error() const { return err_; }
+
+  /** Next time step from the error history
+   *
+   *  @param dtN Latest (accepted or rejected) time step
+   *  @param maxCourant Maximum Courant number of the latest step
+   */
+  double propose_time_step(const double dtN, const double maxCourant);
+
+private:
+  TemporalErrorController() = delete;
+  TemporalErrorController(const TemporalErrorController&) = delete;
+
+  void load(const YAML::Node&);
+
+  void resolve_fields();
+
+  //! Weighted RMS norm of the estimate, maximum over all fields
+  double estimate_error();
+
+  Realm& realm_;
+
+  //! Fields contributing to the estimate; all three-state nodal fields but
+  //! density if empty
+  std::vector<std::string> fieldNames_;
+  std::vector<stk::mesh::FieldBase*> fields_;
+  std::vector<int> numComps_;
+
+  temporal_error::PIControlParams params_;
+
+  double relTol_{1.0e-3};
+  double absTol_{1.0e-6};
+
+  //! Optional Courant limit of the proposed step, inactive if not positive
+  double maxCourant_{0.0};
+
+  int maxRejections_{3};
+  int numRejections_{0};
+
+  double err_{1.0};
+  double errPrev_{1.0};
+  bool haveEstimate_{false};
+  bool rejected_{false};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* TemporalErrorController_h */
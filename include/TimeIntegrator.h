@@ -47,6 +47,14 @@ public:
   void pre_realm_advance_stage1(size_t inonlin = 0);
   void pre_realm_advance_stage2(size_t inonlin = 0);
   void post_realm_advance();
+
+  /** Temporal error check of all realms after the nonlinear iterations
+   *
+   *  A rejected step is rewound: time and step count are reset, the realms
+   *  restore their StateNP1 fields and the next call to
+   *  pre_realm_advance_stage1 retries the step without swapping states.
+   */
+  bool accept_time_step();
   void interstep_updates(int nonLinearIterationIndex);
 
   Simulation* sim_{nullptr};
@@ -65,6 +73,7 @@ public:
   bool adaptiveTimeStep_;
   bool terminateBasedOnTime_;
   int nonlinearIterations_;
+  bool retryTimeStep_{false};
 
   std::string name_;
 
@@ -115,6 +115,11 @@ public:
     const unsigned beginPos,
     const unsigned endPos) override;
 
+  void applyQueuedDirichletBCs() override;
+
+  //! Apply a batch of Dirichlet conditions using the precomputed rows
+  void apply_dirichlet_rows(const std::vector<DirichletBCRequest>& requests);
+
   /** Reset LHS and RHS for the given set of nodes to 0
    *
    *  @param nodeList A list of STK node entities whose rows are zeroed out
@@ -205,6 +210,24 @@ public:
     return sharedNotOwnedRhs_->getLocalViewDevice(Tpetra::Access::ReadWrite);
   }
 
+  /** Matrix entries of the edge stencils
+   *
+   *  Built once the graph is final so that edge assembly scatters directly
+   *  into the matrix instead of sorting the edge nodes and searching the
+   *  rows. Entry (e, 2 * a + b) is the position of the first column of node b
+   *  within the rows of node a; all dof rows of a node share the same columns
+   *  and the dof columns of a node are contiguous. A negative position marks
+   *  an entry that is not in the graph.
+   */
+  struct EdgeOffsetTable
+  {
+    //! Dense index of the first edge of each edge bucket, -1 if not tabulated
+    Kokkos::View<int*, LinSysMemSpace> bucketOffsets;
+    Kokkos::View<int* [4], LinSysMemSpace> entries;
+  };
+
+  const EdgeOffsetTable& edge_offset_table() const { return edgeOffsets_; }
+
   class TpetraLinSysCoeffApplier : public CoeffApplier
   {
   public:
@@ -218,7 +241,8 @@ public:
       LinSys::EntityToLIDView entityColLIDs,
       int maxOwnedRowId,
       int maxSharedNotOwnedRowId,
-      unsigned numDof)
+      unsigned numDof,
+      EdgeOffsetTable edgeOffsets = EdgeOffsetTable())
       : ownedLocalMatrix_(ownedLclMatrix),
         sharedNotOwnedLocalMatrix_(sharedNotOwnedLclMatrix),
         ownedLocalRhs_(ownedLclRhs),
@@ -227,7 +251,8 @@ public:
         entityToColLID_(entityColLIDs),
         maxOwnedRowId_(maxOwnedRowId),
         maxSharedNotOwnedRowId_(maxSharedNotOwnedRowId),
-        numDof_(numDof)
+        numDof_(numDof),
+        edgeOffsets_(edgeOffsets)
     {
     }
 
@@ -253,6 +278,16 @@ public:
       const SharedMemView<const double**, DeviceShmem>& lhs,
       const char* trace_tag);
 
+    KOKKOS_FUNCTION
+    virtual void sum_into_edge(
+      const stk::mesh::FastMeshIndex& edgeIndex,
+      const stk::mesh::NgpMesh::ConnectedNodes& edgeNodes,
+      const SharedMemView<int*, DeviceShmem>& localIds,
+      const SharedMemView<int*, DeviceShmem>& sortPermutation,
+      const SharedMemView<const double*, DeviceShmem>& rhs,
+      const SharedMemView<const double**, DeviceShmem>& lhs,
+      const char* trace_tag);
+
     void free_device_pointer(){};
 
     sierra::nalu::CoeffApplier* device_pointer() { return nullptr; };
@@ -264,6 +299,7 @@ public:
     LinSys::EntityToLIDView entityToColLID_;
     int maxOwnedRowId_, maxSharedNotOwnedRowId_;
     unsigned numDof_;
+    EdgeOffsetTable edgeOffsets_;
   };
 
   void buildConnectedNodeGraph(
@@ -295,6 +331,9 @@ public:
   void fill_entity_to_row_LID_mapping();
   void fill_entity_to_col_LID_mapping();
 
+  //! Tabulate the matrix entries of the edges in the edge graph
+  void build_edge_offset_table();
+
   int insert_connection(stk::mesh::Entity a, stk::mesh::Entity b);
   void addConnections(const stk::mesh::Entity* entities, const size_t&);
   void expand_unordered_map(unsigned newCapacityNeeded);
@@ -344,6 +383,10 @@ public:
                                         // num_sharedNotOwned_nodes) * numDof_
 
   std::vector<int> sortPermutation_;
+
+  //! Parts whose edges contributed to the graph
+  stk::mesh::PartVector edgeGraphParts_;
+  EdgeOffsetTable edgeOffsets_;
 };
 
 template <typename T1, typename T2>
@@ -44,6 +44,8 @@ public:
   VolumeOfFluidEquationSystem(EquationSystems& equationSystems);
   virtual ~VolumeOfFluidEquationSystem();
 
+  virtual void load(const YAML::Node&);
+
   virtual void register_nodal_fields(const stk::mesh::PartVector& part_vec);
   virtual void register_edge_fields(const stk::mesh::PartVector& part_vec);
   virtual void register_element_fields(
@@ -94,14 +96,28 @@ public:
 
   virtual void solve_and_update();
 
+  virtual void pre_timestep_work();
+
+  //! Flag the nodes within narrowBandWidth_ edges of the interface
+  void compute_interface_band();
+
   const bool managePNG_;
   ScalarFieldType* volumeOfFluid_;
   VectorFieldType* dvolumeOfFluiddx_;
   ScalarFieldType* vofTmp_;
+  ScalarFieldType* interfaceBand_{nullptr};
 
   ScalarNodalGradAlgDriver nodalGradAlgDriver_;
   ProjectedNodalGradientEquationSystem* projectedNodalGradEqs_;
   bool isInit_;
+
+  //! Keep the preconditioner of the first sub-iteration for the remaining
+  //! sub-iterations of an outer iteration
+  bool reusePrecondSubIters_{false};
+
+  //! Number of edge layers around the interface where the compression and
+  //! gradient are evaluated; zero disables the narrow band
+  int narrowBandWidth_{0};
 };
 
 } // namespace nalu
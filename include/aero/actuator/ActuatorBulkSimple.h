@@ -41,12 +41,15 @@ struct ActuatorMetaSimple : public ActuatorMeta
   Act2DArrayDblDv chord_tableDv_;
   Act2DArrayDblDv twistTableDv_;
   Act2DArrayDblDv elemAreaDv_;
-  // for the polars
+  // for the polars, indexed by the airfoil id over all blades
+  std::size_t numAirfoils_;
   std::size_t maxPolarTableSize_;
   ActScalarIntDv polarTableSize_;
   Act2DArrayDblDv aoaPolarTableDv_;
   Act2DArrayDblDv clPolarTableDv_;
   Act2DArrayDblDv cdPolarTableDv_;
+  // airfoil id of every force point (blade, point)
+  Act2DArrayIntDv airfoilIdDv_;
 
   std::vector<std::string> output_filenames_;
   bool has_output_file_;
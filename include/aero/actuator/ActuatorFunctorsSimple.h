@@ -46,6 +46,40 @@ void calculate_alpha(
   double twist,
   double ws2Da[],
   double& alpha);
+
+/** Interpolate cl and cd from an airfoil polar
+ *
+ * The aoa table must be strictly increasing with at least two entries.
+ * Angles outside of the table are clamped to the end points. The bisection
+ * always takes ceil(log2(n - 1)) steps and uses selects instead of branches,
+ * so that neighboring points follow the same path on the device.
+ */
+KOKKOS_INLINE_FUNCTION void
+polar_lookup(
+  const int n,
+  const double* aoa,
+  const double* cl,
+  const double* cd,
+  double alpha,
+  double& clOut,
+  double& cdOut)
+{
+  alpha = (alpha < aoa[0]) ? aoa[0] : alpha;
+  alpha = (alpha > aoa[n - 1]) ? aoa[n - 1] : alpha;
+
+  // find i such that aoa[i] <= alpha <= aoa[i + 1]
+  int i = 0;
+  int len = n - 1;
+  while (len > 1) {
+    const int half = len / 2;
+    i = (aoa[i + half] < alpha) ? i + half : i;
+    len -= half;
+  }
+
+  const double fac = (alpha - aoa[i]) / (aoa[i + 1] - aoa[i]);
+  clOut = (1.0 - fac) * cl[i] + fac * cl[i + 1];
+  cdOut = (1.0 - fac) * cd[i] + fac * cd[i + 1];
+}
 } // namespace AirfoilTheory2D
 
 #ifdef ENABLE_ACTSIMPLE_PTMOTION
@@ -48,6 +48,8 @@ using ActTensorDblDv =
   Kokkos::DualView<double* [9], ActuatorMemLayout, ActuatorMemSpace>;
 using Act2DArrayDblDv =
   Kokkos::DualView<double**, ActuatorMemLayout, ActuatorMemSpace>;
+using Act2DArrayIntDv =
+  Kokkos::DualView<int**, ActuatorMemLayout, ActuatorMemSpace>;
 
 // VIEWS
 using ActScalarInt = Kokkos::View<int*, ActuatorMemLayout, ActuatorMemSpace>;
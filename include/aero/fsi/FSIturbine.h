@@ -19,6 +19,7 @@
 #include "stk_mesh/base/CoordinateSystems.hpp"
 #include "stk_mesh/base/Field.hpp"
 #include "FieldTypeDef.h"
+#include "utils/HostScratchArena.h"
 #include <stk_search/Point.hpp>
 
 #include <vector>
@@ -280,6 +281,9 @@ private:
 
   std::shared_ptr<stk::mesh::BulkData> bulk_;
 
+  //! Workspace of the host-side mapping loops
+  HostScratchArena scratch_;
+
   int turbineProc_;    // The MPI rank containing the OpenFAST instance of the
                        // turbine
   bool turbineInProc_; // A boolean flag to determine if the processor contains
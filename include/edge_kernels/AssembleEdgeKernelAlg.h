@@ -11,6 +11,7 @@
 #define ASSEMBLEEDGEKERNEL_H
 
 #include "AssembleEdgeSolverAlgorithm.h"
+#include "NGPInstance.h"
 
 #include <vector>
 #include <memory>
@@ -41,6 +42,9 @@ public:
 
 protected:
   EdgeKernelVecType edgeKernels_;
+
+  //! Device view of the kernels; rebuilt only when the kernel list changes
+  nalu_ngp::NGPKernelView<EdgeKernel> ngpKernels_;
 };
 
 } // namespace nalu
@@ -0,0 +1,73 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef MOMENTUMWALLFUNCTIONEDGEKERNEL_H
+#define MOMENTUMWALLFUNCTIONEDGEKERNEL_H
+
+#include "kernel/Kernel.h"
+#include "KokkosInterface.h"
+#include "FieldTypeDef.h"
+
+#include "stk_mesh/base/MetaData.hpp"
+#include "stk_mesh/base/Entity.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class SolutionOptions;
+class ElemDataRequests;
+class MasterElement;
+
+/** Edge-based (nearest node) wall function for the momentum equation
+ *
+ *  Used for the engineering-style (non-ABL) wall function boundary condition;
+ *  the wall shear stress follows the viscous sublayer or the log law depending
+ *  on yplus.
+ */
+template <typename BcAlgTraits>
+class MomentumWallFunctionEdgeKernel
+  : public NGPKernel<MomentumWallFunctionEdgeKernel<BcAlgTraits>>
+{
+public:
+  MomentumWallFunctionEdgeKernel(
+    const stk::mesh::MetaData&, const SolutionOptions&, ElemDataRequests&);
+
+  KOKKOS_DEFAULTED_FUNCTION MomentumWallFunctionEdgeKernel() = default;
+
+  KOKKOS_DEFAULTED_FUNCTION virtual ~MomentumWallFunctionEdgeKernel() = default;
+
+  using Kernel::execute;
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    SharedMemView<DoubleType**, DeviceShmem>&,
+    SharedMemView<DoubleType*, DeviceShmem>&,
+    ScratchViews<DoubleType, DeviceTeamHandleType, DeviceShmem>&);
+
+private:
+  unsigned velocityNp1_{stk::mesh::InvalidOrdinal};
+  unsigned bcVelocity_{stk::mesh::InvalidOrdinal};
+  unsigned density_{stk::mesh::InvalidOrdinal};
+  unsigned viscosity_{stk::mesh::InvalidOrdinal};
+  unsigned exposedAreaVec_{stk::mesh::InvalidOrdinal};
+  unsigned wallFricVel_{stk::mesh::InvalidOrdinal};
+  unsigned wallNormDist_{stk::mesh::InvalidOrdinal};
+
+  // turbulence model constants (constant over time and bc surfaces)
+  const DoubleType elog_;
+  const DoubleType kappa_;
+  const DoubleType yplusCrit_;
+
+  MasterElement* meFC_{nullptr};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* MOMENTUMWALLFUNCTIONEDGEKERNEL_H */
@@ -0,0 +1,76 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef SCALAREIGENEDGESOLVERALG_H
+#define SCALAREIGENEDGESOLVERALG_H
+
+#include "AssembleEdgeSolverAlgorithm.h"
+#include "PecletFunction.h"
+
+namespace sierra {
+namespace nalu {
+
+/** Edge-based scalar advection-diffusion with a GGDH turbulent flux
+ *
+ *  The Reynolds stress used by the generalized gradient diffusion hypothesis
+ *  is perturbed through its anisotropy eigenvalues (UQ eigenvalue
+ *  perturbation; three-dimensional meshes only).
+ */
+class ScalarEigenEdgeSolverAlg : public AssembleEdgeSolverAlgorithm
+{
+public:
+  ScalarEigenEdgeSolverAlg(
+    Realm&,
+    stk::mesh::Part*,
+    EquationSystem*,
+    ScalarFieldType*,
+    VectorFieldType*,
+    ScalarFieldType*,
+    ScalarFieldType*,
+    ScalarFieldType*,
+    const double);
+
+  virtual ~ScalarEigenEdgeSolverAlg() = default;
+
+  virtual void execute();
+
+private:
+  unsigned coordinates_{stk::mesh::InvalidOrdinal};
+  unsigned velocityRTM_{stk::mesh::InvalidOrdinal};
+  unsigned scalarQ_{stk::mesh::InvalidOrdinal};
+  unsigned dqdx_{stk::mesh::InvalidOrdinal};
+  unsigned thermalCond_{stk::mesh::InvalidOrdinal};
+  unsigned specHeat_{stk::mesh::InvalidOrdinal};
+  unsigned turbViscosity_{stk::mesh::InvalidOrdinal};
+  unsigned density_{stk::mesh::InvalidOrdinal};
+  unsigned edgeAreaVec_{stk::mesh::InvalidOrdinal};
+  unsigned massFlowRate_{stk::mesh::InvalidOrdinal};
+  unsigned turbKe_{stk::mesh::InvalidOrdinal};
+  unsigned velocity_{stk::mesh::InvalidOrdinal};
+  unsigned dudx_{stk::mesh::InvalidOrdinal};
+
+  PecletFunction<AssembleEdgeSolverAlgorithm::DblType>* pecletFunction_{
+    nullptr};
+
+  std::string dofName_;
+
+  const DblType includeDivU_;
+  const DblType turbSigma_;
+
+  // constants and perturbation from user
+  const DblType cGGDH_;
+  const DblType deltaB_;
+  const DblType perturbTurbKe_;
+  DblType BinvXt_[3]{0.0, 0.0, 0.0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* SCALAREIGENEDGESOLVERALG_H */
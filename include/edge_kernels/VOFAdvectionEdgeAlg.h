@@ -27,7 +27,8 @@ public:
     EquationSystem*,
     ScalarFieldType*,
     VectorFieldType*,
-    const bool = false);
+    const bool = false,
+    ScalarFieldType* interfaceBand = nullptr);
 
   virtual ~VOFAdvectionEdgeAlg() = default;
 
@@ -40,6 +41,10 @@ private:
   unsigned edgeAreaVec_{stk::mesh::InvalidOrdinal};
   unsigned massFlowRate_{stk::mesh::InvalidOrdinal};
   unsigned density_{stk::mesh::InvalidOrdinal};
+
+  //! Nodes near the interface; compression is only applied on edges touching
+  //! a non-zero node when this field is registered
+  unsigned interfaceBand_{stk::mesh::InvalidOrdinal};
 };
 
 } // namespace nalu
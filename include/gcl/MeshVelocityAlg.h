@@ -26,7 +26,12 @@ template <typename AlgTraits>
 class MeshVelocityAlg : public Algorithm
 {
 public:
-  MeshVelocityAlg(Realm&, stk::mesh::Part*);
+  /**
+   *  @param rigidMotion Part moves rigidly; the swept volumes are obtained
+   *  from the flux of the mesh velocity through the current subcontrol
+   *  surfaces instead of the volume swept by the interpolated faces
+   */
+  MeshVelocityAlg(Realm&, stk::mesh::Part*, const bool rigidMotion = false);
 
   virtual ~MeshVelocityAlg() = default;
 
@@ -39,12 +44,15 @@ private:
   unsigned currentCoords_{stk::mesh::InvalidOrdinal};
   unsigned meshDispNp1_{stk::mesh::InvalidOrdinal};
   unsigned meshDispN_{stk::mesh::InvalidOrdinal};
+  unsigned meshVelocity_{stk::mesh::InvalidOrdinal};
   unsigned faceVelMag_{stk::mesh::InvalidOrdinal};
   unsigned sweptVolumeNp1_{stk::mesh::InvalidOrdinal};
   unsigned sweptVolumeN_{stk::mesh::InvalidOrdinal};
 
   MasterElement* meSCS_{nullptr};
 
+  const bool rigidMotion_{false};
+
   const double isoParCoords_[57] = {
     0.00,  -1.00, -1.00, // surf 1    1->2  0  8
     1.00,  0.00,  -1.00, // surf 2    2->3  1  9
@@ -26,7 +26,13 @@ template <typename AlgTraits>
 class MeshVelocityEdgeAlg : public Algorithm
 {
 public:
-  MeshVelocityEdgeAlg(Realm&, stk::mesh::Part*);
+  /**
+   *  @param rigidMotion Part moves rigidly; the swept volumes are obtained
+   *  from the flux of the mesh velocity through the current subcontrol
+   *  surfaces instead of the volume swept by the interpolated faces
+   */
+  MeshVelocityEdgeAlg(
+    Realm&, stk::mesh::Part*, const bool rigidMotion = false);
 
   virtual ~MeshVelocityEdgeAlg() = default;
 
@@ -39,12 +45,15 @@ private:
   unsigned currentCoords_{stk::mesh::InvalidOrdinal};
   unsigned meshDispNp1_{stk::mesh::InvalidOrdinal};
   unsigned meshDispN_{stk::mesh::InvalidOrdinal};
+  unsigned meshVelocity_{stk::mesh::InvalidOrdinal};
   unsigned edgeFaceVelMag_{stk::mesh::InvalidOrdinal};
   unsigned edgeSweptVolumeNp1_{stk::mesh::InvalidOrdinal};
   unsigned edgeSweptVolumeN_{stk::mesh::InvalidOrdinal};
 
   MasterElement* meSCS_{nullptr};
 
+  const bool rigidMotion_{false};
+
   const double isoParCoords_[57] = {
     0.00,  -1.00, -1.00, // surf 1    1->2  0  8
     1.00,  0.00,  -1.00, // surf 2    2->3  1  9
@@ -0,0 +1,67 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef PROJECTEDNODALGRADIENTBCELEMKERNEL_H
+#define PROJECTEDNODALGRADIENTBCELEMKERNEL_H
+
+#include "kernel/Kernel.h"
+#include "FieldTypeDef.h"
+
+#include "stk_mesh/base/Entity.hpp"
+
+#include <string>
+
+namespace sierra {
+namespace nalu {
+
+class ElemDataRequests;
+class MasterElement;
+
+/** Boundary contribution to the projected nodal gradient system
+ *
+ *  Closes the surface integral of q with the boundary value of q; there is no
+ *  LHS contribution.
+ */
+template <typename BcAlgTraits>
+class ProjectedNodalGradientBCElemKernel
+  : public NGPKernel<ProjectedNodalGradientBCElemKernel<BcAlgTraits>>
+{
+public:
+  ProjectedNodalGradientBCElemKernel(
+    const stk::mesh::BulkData&,
+    const std::string&,
+    const std::string&,
+    ElemDataRequests&);
+
+  KOKKOS_DEFAULTED_FUNCTION
+  ProjectedNodalGradientBCElemKernel() = default;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~ProjectedNodalGradientBCElemKernel() = default;
+
+  using Kernel::execute;
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    SharedMemView<DoubleType**, DeviceShmem>&,
+    SharedMemView<DoubleType*, DeviceShmem>&,
+    ScratchViews<DoubleType, DeviceTeamHandleType, DeviceShmem>&);
+
+private:
+  unsigned coordinates_{stk::mesh::InvalidOrdinal};
+  unsigned bcScalarQ_{stk::mesh::InvalidOrdinal};
+  unsigned exposedAreaVec_{stk::mesh::InvalidOrdinal};
+
+  MasterElement* meFC_{nullptr};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* PROJECTEDNODALGRADIENTBCELEMKERNEL_H */
@@ -0,0 +1,69 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef PROJECTEDNODALGRADIENTELEMKERNEL_H
+#define PROJECTEDNODALGRADIENTELEMKERNEL_H
+
+#include "kernel/Kernel.h"
+#include "FieldTypeDef.h"
+
+#include "stk_mesh/base/Entity.hpp"
+
+#include <string>
+
+namespace sierra {
+namespace nalu {
+
+class MasterElement;
+class ElemDataRequests;
+
+/** Interior contribution to the projected nodal gradient system
+ *
+ *  Assembles the consistent mass matrix of all nDim components of dq/dx as a
+ *  single block system; the matrix depends on the geometry only. The RHS is
+ *  the residual of the Gauss-divergence projection of q. Both are summed on
+ *  every assembly; the equation system only reuses the preconditioner.
+ */
+template <typename AlgTraits>
+class ProjectedNodalGradientElemKernel
+  : public NGPKernel<ProjectedNodalGradientElemKernel<AlgTraits>>
+{
+public:
+  ProjectedNodalGradientElemKernel(
+    const stk::mesh::BulkData&,
+    const std::string&,
+    const std::string&,
+    const std::string&,
+    ElemDataRequests&);
+
+  KOKKOS_DEFAULTED_FUNCTION ProjectedNodalGradientElemKernel() = default;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~ProjectedNodalGradientElemKernel() = default;
+
+  using Kernel::execute;
+  KOKKOS_FUNCTION
+  virtual void execute(
+    SharedMemView<DoubleType**, DeviceShmem>&,
+    SharedMemView<DoubleType*, DeviceShmem>&,
+    ScratchViews<DoubleType, DeviceTeamHandleType, DeviceShmem>&);
+
+private:
+  unsigned coordinates_{stk::mesh::InvalidOrdinal};
+  unsigned scalarQ_{stk::mesh::InvalidOrdinal};
+  unsigned dqdx_{stk::mesh::InvalidOrdinal};
+
+  MasterElement* meSCS_{nullptr};
+  MasterElement* meSCV_{nullptr};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* PROJECTEDNODALGRADIENTELEMKERNEL_H */
@@ -22,6 +22,7 @@
 #include <stk_util/util/ReportHandler.hpp>
 
 #include <iosfwd>
+#include <vector>
 
 namespace sierra {
 namespace nalu {
@@ -47,6 +48,24 @@ struct BCFields
   BCFluxFields<p> flux_fields;
 };
 
+// one wedge, tet or pyramid batch, see TopologyConductionInterior.h
+struct TopologyResidualFields
+{
+  topo_lrscv_view lrscv;
+  topo_scalar_view qm1;
+  topo_scalar_view qp0;
+  topo_scalar_view qp1;
+  topo_scalar_view volume_metric;
+  topo_scs_node_view diffusion_metric;
+};
+
+struct TopologyLinearizedResidualFields
+{
+  topo_lrscv_view lrscv;
+  topo_scalar_view volume_metric;
+  topo_scs_node_view diffusion_metric;
+};
+
 template <int p>
 struct InteriorResidualFields
 {
@@ -55,6 +74,7 @@ struct InteriorResidualFields
   scalar_view<p> qp1;
   scalar_view<p> volume_metric;
   scs_vector_view<p> diffusion_metric;
+  std::vector<TopologyResidualFields> topology_fields;
 };
 
 template <int p>
@@ -62,6 +82,7 @@ struct LinearizedResidualFields
 {
   scalar_view<p> volume_metric;
   scs_vector_view<p> diffusion_metric;
+  std::vector<TopologyLinearizedResidualFields> topology_fields;
 };
 
 namespace impl {
@@ -76,6 +97,9 @@ struct gather_required_conduction_fields_t
 } // namespace impl
 P_INVOKEABLE(gather_required_conduction_fields)
 
+TopologyResidualFields gather_required_topology_conduction_fields(
+  const stk::mesh::MetaData&, stk::topology, const_topo_mesh_index_view);
+
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
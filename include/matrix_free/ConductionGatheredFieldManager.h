@@ -13,6 +13,9 @@
 #include "matrix_free/ConductionFields.h"
 #include "matrix_free/KokkosViewTypes.h"
 #include <stk_mesh/base/Selector.hpp>
+#include <stk_topology/topology.hpp>
+
+#include <vector>
 
 namespace stk {
 namespace mesh {
@@ -53,6 +56,8 @@ private:
 
   const stk::mesh::Selector active;
   const const_elem_mesh_index_view<p> conn;
+  const std::vector<stk::topology> topologies;
+  std::vector<const_topo_mesh_index_view> topology_conn;
   InteriorResidualFields<p> fields;
   LinearizedResidualFields<p> coefficient_fields;
 
@@ -16,6 +16,8 @@
 #include "matrix_free/ConductionFields.h"
 #include "matrix_free/KokkosViewTypes.h"
 
+#include <vector>
+
 namespace sierra {
 namespace nalu {
 namespace matrix_free {
@@ -54,6 +56,11 @@ public:
     fields_ = fields_in;
   }
 
+  void set_topology_offsets(std::vector<const_topo_offset_view> offsets_in)
+  {
+    topology_offsets_ = offsets_in;
+  }
+
   void compute_diagonal();
   mv_type& get_inverse_diagonal() { return owned_diagonal_; }
   void set_linear_operator(Teuchos::RCP<const Tpetra::Operator<>>);
@@ -69,6 +76,7 @@ public:
 
 private:
   const const_elem_offset_view<p> elem_offsets_;
+  std::vector<const_topo_offset_view> topology_offsets_;
   const export_type& exporter_;
   const int num_sweeps_;
   mv_type owned_diagonal_;
@@ -21,6 +21,8 @@
 #include "Tpetra_Operator.hpp"
 #include "matrix_free/ConductionFields.h"
 
+#include <vector>
+
 namespace sierra {
 namespace nalu {
 namespace matrix_free {
@@ -52,6 +54,11 @@ public:
     residual_fields_ = residual_fields_in;
   }
 
+  void set_topology_offsets(std::vector<const_topo_offset_view> offsets_in)
+  {
+    topology_offsets_ = offsets_in;
+  }
+
   void set_bc_fields(
     const_node_offset_view dirichlet_offsets_in,
     node_scalar_view solution_q,
@@ -76,6 +83,7 @@ public:
 
 private:
   const const_elem_offset_view<p> elem_offsets_;
+  std::vector<const_topo_offset_view> topology_offsets_;
   const export_type& exporter_;
 
   mutable mv_type cached_shared_rhs_;
@@ -127,6 +135,11 @@ public:
     dirichlet_bc_offsets_ = dirichlet_offsets;
   }
 
+  void set_topology_offsets(std::vector<const_topo_offset_view> offsets_in)
+  {
+    topology_offsets_ = offsets_in;
+  }
+
   Teuchos::RCP<const map_type> getDomainMap() const final
   {
     return exporter_.getTargetMap();
@@ -138,6 +151,7 @@ public:
 
 private:
   const const_elem_offset_view<p> elem_offsets_;
+  std::vector<const_topo_offset_view> topology_offsets_;
   const export_type& exporter_;
 
   bool dirichlet_bc_active_{false};
@@ -22,6 +22,8 @@
 #include "stk_mesh/base/Ngp.hpp"
 #include "stk_mesh/base/Selector.hpp"
 
+#include <vector>
+
 namespace Teuchos {
 class ParameterList;
 }
@@ -51,6 +53,7 @@ struct ConductionOffsetViews
     stk::mesh::Selector flux = {});
 
   const const_elem_offset_view<p> offsets;
+  const std::vector<const_topo_offset_view> topology_offsets;
   const const_node_offset_view dirichlet_bc_offsets;
   const const_face_offset_view<p> flux_bc_offsets;
 };
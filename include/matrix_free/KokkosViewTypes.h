@@ -242,6 +242,80 @@ using const_node_vector_view = Kokkos::View<
   typename ExecTraits<exec_space>::memory_space,
   typename ExecTraits<exec_space>::memory_traits>;
 
+// dense per-topology batches (wedge, tet, pyramid) indexed by
+// (simd element, node or sub-control-surface, ...)
+using topo_mesh_index_view = Kokkos::View<
+  stk::mesh::FastMeshIndex** [simd_len],
+  typename ExecTraits<exec_space>::layout,
+  typename ExecTraits<exec_space>::memory_space,
+  typename ExecTraits<exec_space>::memory_traits>;
+
+using const_topo_mesh_index_view = Kokkos::View<
+  const stk::mesh::FastMeshIndex** [simd_len],
+  typename ExecTraits<exec_space>::layout,
+  typename ExecTraits<exec_space>::memory_space,
+  typename ExecTraits<exec_space>::memory_traits>;
+
+using topo_offset_view = Kokkos::View<
+  int** [simd_len],
+  typename ExecTraits<exec_space>::layout,
+  typename ExecTraits<exec_space>::memory_space,
+  typename ExecTraits<exec_space>::memory_traits>;
+
+using const_topo_offset_view = Kokkos::View<
+  const int** [simd_len],
+  typename ExecTraits<exec_space>::layout,
+  typename ExecTraits<exec_space>::memory_space,
+  typename ExecTraits<exec_space>::memory_traits>;
+
+using topo_scalar_view = Kokkos::View<
+  ftype**,
+  typename ExecTraits<exec_space>::layout,
+  typename ExecTraits<exec_space>::memory_space,
+  typename ExecTraits<exec_space>::memory_traits>;
+
+using const_topo_scalar_view = Kokkos::View<
+  const ftype**,
+  typename ExecTraits<exec_space>::layout,
+  typename ExecTraits<exec_space>::memory_space,
+  typename ExecTraits<exec_space>::memory_traits>;
+
+using topo_vector_view = Kokkos::View<
+  ftype** [3],
+  typename ExecTraits<exec_space>::layout,
+  typename ExecTraits<exec_space>::memory_space,
+  typename ExecTraits<exec_space>::memory_traits>;
+
+using const_topo_vector_view = Kokkos::View<
+  const ftype** [3],
+  typename ExecTraits<exec_space>::layout,
+  typename ExecTraits<exec_space>::memory_space,
+  typename ExecTraits<exec_space>::memory_traits>;
+
+using topo_scs_node_view = Kokkos::View<
+  ftype***,
+  typename ExecTraits<exec_space>::layout,
+  typename ExecTraits<exec_space>::memory_space,
+  typename ExecTraits<exec_space>::memory_traits>;
+
+using const_topo_scs_node_view = Kokkos::View<
+  const ftype***,
+  typename ExecTraits<exec_space>::layout,
+  typename ExecTraits<exec_space>::memory_space,
+  typename ExecTraits<exec_space>::memory_traits>;
+
+using topo_lrscv_view = Kokkos::View<
+  int* [2],
+  typename ExecTraits<exec_space>::layout,
+  typename ExecTraits<exec_space>::memory_space,
+  typename ExecTraits<exec_space>::memory_traits>;
+
+using const_topo_lrscv_view = Kokkos::View<
+  const int* [2],
+  typename ExecTraits<exec_space>::layout,
+  typename ExecTraits<exec_space>::memory_space,
+  typename ExecTraits<exec_space>::memory_traits>;
+
 template <int p>
 using scalar_view = view_type<p, FieldType::NODAL_SCALAR, exec_space>;
 template <int p>
@@ -14,6 +14,9 @@
 #include "matrix_free/PolynomialOrders.h"
 #include "stk_mesh/base/Ngp.hpp"
 #include "stk_mesh/base/Selector.hpp"
+#include "stk_topology/topology.hpp"
+
+#include <vector>
 
 namespace sierra {
 namespace nalu {
@@ -40,6 +43,26 @@ struct create_offset_map_t
 };
 } // namespace impl
 P_INVOKEABLE(create_offset_map)
+
+// dense maps for the non-tensor-product topologies: nodes in stk order,
+// restricted to the elements of `topo` within `active`
+topo_mesh_index_view topology_connectivity_map(
+  const stk::mesh::NgpMesh&, stk::topology, const stk::mesh::Selector&);
+
+topo_offset_view create_topology_offset_map(
+  const stk::mesh::NgpMesh&,
+  stk::topology,
+  const stk::mesh::Selector&,
+  ra_entity_row_view_type);
+
+// wedge, tet and pyramid topologies with elements in `active`, in a fixed
+// order so that separately built maps line up
+std::vector<stk::topology>
+dense_topologies(const stk::mesh::NgpMesh&, const stk::mesh::Selector&);
+
+// the elements of `active` left for the tensor-product kernels
+stk::mesh::Selector
+tensor_product_selector(const stk::mesh::NgpMesh&, const stk::mesh::Selector&);
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
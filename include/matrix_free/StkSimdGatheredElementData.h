@@ -97,6 +97,16 @@ void field_gather(
   const stk::mesh::NgpField<double>&,
   node_vector_view);
 
+void field_gather(
+  const_topo_mesh_index_view,
+  const stk::mesh::NgpField<double>&,
+  topo_scalar_view);
+
+void field_gather(
+  const_topo_mesh_index_view,
+  const stk::mesh::NgpField<double>&,
+  topo_vector_view);
+
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
@@ -0,0 +1,59 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef TOPOLOGY_CONDUCTION_INTERIOR_H
+#define TOPOLOGY_CONDUCTION_INTERIOR_H
+
+#include "matrix_free/ConductionInterior.h"
+#include "matrix_free/KokkosViewTypes.h"
+
+#include "Kokkos_Array.hpp"
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+
+// dense counterparts of conduction_residual/conduction_linearized_residual
+// for the wedge, tet and pyramid batches; lumped mass, metrics from
+// geom::topology_volume_metric and geom::topology_diffusion_metric
+void topology_conduction_residual(
+  Kokkos::Array<double, 3> gammas,
+  const_topo_lrscv_view lrscv,
+  const_topo_offset_view offsets,
+  const_topo_scalar_view qm1,
+  const_topo_scalar_view qp0,
+  const_topo_scalar_view qp1,
+  const_topo_scalar_view volume_metric,
+  const_topo_scs_node_view diffusion_metric,
+  tpetra_view_type owned_rhs);
+
+void topology_conduction_linearized_residual(
+  double gamma,
+  const_topo_lrscv_view lrscv,
+  const_topo_offset_view offsets,
+  const_topo_scalar_view volume_metric,
+  const_topo_scs_node_view diffusion_metric,
+  ra_tpetra_view_type delta_owned,
+  tpetra_view_type rhs);
+
+// diagonal of topology_conduction_linearized_residual, for the Jacobi
+// preconditioner
+void topology_conduction_diagonal(
+  double gamma,
+  const_topo_lrscv_view lrscv,
+  const_topo_offset_view offsets,
+  const_topo_scalar_view volume_metric,
+  const_topo_scs_node_view diffusion_metric,
+  tpetra_view_type owned_yout);
+
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -0,0 +1,56 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef TOPOLOGY_METRICS_H
+#define TOPOLOGY_METRICS_H
+
+#include "matrix_free/KokkosViewTypes.h"
+
+#include "stk_topology/topology.hpp"
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+namespace geom {
+
+// Metrics for the non-tensor-product linear topologies (wedge, tet and
+// pyramid).  The sub-control volumes and surfaces are the ones of the
+// Wed6CVFEM, Tet4CVFEM and Pyr5CVFEM master elements, so an operator built
+// from these matches the assembled CVFEM discretization
+
+static constexpr int max_topo_nodes = 6;
+static constexpr int max_topo_scs = 12;
+
+bool topology_supported(stk::topology topo);
+
+// left/right node pair of each sub-control surface
+topo_lrscv_view topology_lrscv(stk::topology topo);
+
+// lumped volume of each sub-control volume, (simd elem, node)
+topo_scalar_view
+topology_volume_metric(stk::topology topo, const_topo_vector_view coordinates);
+topo_scalar_view topology_volume_metric(
+  stk::topology topo,
+  const_topo_scalar_view alpha,
+  const_topo_vector_view coordinates);
+
+// dense -alpha_ip A_ip . grad N_n(ip), (simd elem, scs, node)
+topo_scs_node_view topology_diffusion_metric(
+  stk::topology topo, const_topo_vector_view coordinates);
+topo_scs_node_view topology_diffusion_metric(
+  stk::topology topo,
+  const_topo_scalar_view alpha,
+  const_topo_vector_view coordinates);
+
+} // namespace geom
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
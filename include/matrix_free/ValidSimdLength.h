@@ -76,6 +76,26 @@ struct valid_offset_t
     }
     return n + 1;
   }
+
+  static KOKKOS_FORCEINLINE_FUNCTION int
+  valid_offset(int index, const const_topo_offset_view& offsets)
+  {
+    int n = simd_len - 1;
+    while (offsets(index, 0, n) < 0 && n != 0) {
+      --n;
+    }
+    return n + 1;
+  }
+
+  static KOKKOS_FORCEINLINE_FUNCTION int
+  valid_offset(int index, const const_topo_mesh_index_view& offsets)
+  {
+    int n = simd_len - 1;
+    while (!valid_mesh_index(offsets(index, 0, n)) && n != 0) {
+      --n;
+    }
+    return n + 1;
+  }
 };
 
 template <int p>
@@ -115,6 +135,18 @@ valid_offset(int index, const const_elem_mesh_index_view<p>& offsets)
   return impl::valid_offset_t<p, simd_len>::valid_offset(index, offsets);
 }
 
+KOKKOS_FORCEINLINE_FUNCTION int
+valid_offset(int index, const const_topo_offset_view& offsets)
+{
+  return impl::valid_offset_t<0, simd_len>::valid_offset(index, offsets);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION int
+valid_offset(int index, const const_topo_mesh_index_view& offsets)
+{
+  return impl::valid_offset_t<0, simd_len>::valid_offset(index, offsets);
+}
+
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
@@ -2,6 +2,7 @@
 #define FRAMEBASE_H
 
 #include "NgpMotion.h"
+#include "SixDofRigidBody.h"
 
 // stk base header files
 #include "stk_mesh/base/CoordinateSystems.hpp"
@@ -39,6 +40,12 @@ public:
 
   bool is_deforming() { return isDeforming_; }
 
+  //! Rigid bodies whose motion is driven by the fluid loads
+  const std::vector<std::unique_ptr<SixDofRigidBody>>& rigid_bodies() const
+  {
+    return rigidBodies_;
+  }
+
 protected:
   //! Reference to the STK Mesh BulkData object
   stk::mesh::BulkData& bulk_;
@@ -52,6 +59,12 @@ protected:
    */
   std::vector<std::unique_ptr<NgpMotion>> motionKernels_;
 
+  //! Device view of the motion kernels reused across time steps
+  nalu_ngp::NGPKernelView<NgpMotion> ngpKernels_;
+
+  //! Dynamics of the six_dof motions in motionKernels_
+  std::vector<std::unique_ptr<SixDofRigidBody>> rigidBodies_;
+
   /** Motion parts
    *
    *  A vector of size number of parts
@@ -14,10 +14,7 @@ namespace nalu {
 class FrameMoving : public FrameBase
 {
 public:
-  FrameMoving(stk::mesh::BulkData& bulk, const YAML::Node& node)
-    : FrameBase(bulk, node)
-  {
-  }
+  FrameMoving(stk::mesh::BulkData& bulk, const YAML::Node& node);
 
   virtual ~FrameMoving() {}
 
@@ -25,9 +22,59 @@ public:
 
   void post_compute_geometry();
 
+  /** Frame only translates and rotates
+   *
+   *  Only rotation, translation and six_dof motions qualify; scaling keeps
+   *  the transformation node-independent but changes volumes and areas.
+   */
+  bool is_rigid() const;
+
+  /** Store the area vectors of the frame in the model configuration
+   *
+   *  Rotates the current edge and exposed area vectors back by the frame
+   *  rotation of the last coordinate update. Only valid for rigid frames.
+   */
+  void set_reference_geometry();
+
+  /** Rotate the reference area vectors into the current configuration
+   *
+   *  Replaces the geometry recomputation for rigid frames, whose volumes are
+   *  invariant and whose area vectors rotate with the frame.
+   */
+  void update_rigid_geometry();
+
 private:
   FrameMoving() = delete;
   FrameMoving(const FrameMoving&) = delete;
+
+  /** Compute the composite transformations of node-independent motions
+   *
+   *  Consecutive node-independent motions are collapsed into a single matrix
+   *  that is built once on host. Entry j of the stage array holds the product
+   *  of the node-independent motions that are applied after the j-th
+   *  node-dependent motion (entry 0 holds those applied before any).
+   */
+  void compute_stage_transformations(const double time);
+
+  using TransMatViewType = Kokkos::View<mm::TransMatType*, MemSpace>;
+  using IndexViewType = Kokkos::View<int*, MemSpace>;
+
+  //! Composite transformations of node-independent motions
+  TransMatViewType stageTrans_;
+  TransMatViewType::HostMirror stageTransHost_;
+
+  //! Indices of motion kernels that must be evaluated for every node
+  IndexViewType depKernelIdx_;
+
+  //! Area vectors of the frame entities in the model configuration
+  struct ReferenceAreaVectors
+  {
+    unsigned fieldOrdinal;
+    Kokkos::View<stk::mesh::FastMeshIndex*, MemSpace> entities;
+    Kokkos::View<double**, MemSpace> values;
+  };
+
+  std::vector<ReferenceAreaVectors> refAreaVecs_;
 };
 
 } // namespace nalu
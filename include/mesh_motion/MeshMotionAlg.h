@@ -26,6 +26,21 @@ public:
 
   bool is_deforming() { return isDeforming_; }
 
+  //! All moving frames only translate and rotate
+  bool is_rigid();
+
+  //! Part belongs to moving frames that only translate and rotate
+  bool is_rigid(const stk::mesh::Part* part);
+
+  //! Store the model configuration area vectors of all (rigid) frames
+  void set_reference_geometry();
+
+  //! Rotate the area vectors of all (rigid) frames to the current time
+  void update_rigid_geometry();
+
+  //! Rigid bodies of all frames whose motion is driven by the fluid loads
+  std::vector<SixDofRigidBody*> rigid_bodies();
+
 private:
   MeshMotionAlg() = delete;
   MeshMotionAlg(const MeshMotionAlg&) = delete;
@@ -0,0 +1,80 @@
+#ifndef MOTIONSIXDOFKERNEL_H
+#define MOTIONSIXDOFKERNEL_H
+
+#include "NgpMotion.h"
+
+namespace sierra {
+namespace nalu {
+
+/** Rigid-body motion with six degrees of freedom
+ *
+ *  The kernel only holds the pose and velocities of the body at the current
+ *  time level; they are computed by SixDofRigidBody from the fluid loads and
+ *  set through set_state() before the mesh is moved.
+ */
+class MotionSixDofKernel : public NgpMotionKernel<MotionSixDofKernel>
+{
+public:
+  MotionSixDofKernel(const YAML::Node&);
+
+  MotionSixDofKernel() = default;
+
+  virtual ~MotionSixDofKernel() = default;
+
+  /** Function to compute motion-specific transformation matrix
+   *
+   * @param[in] time Current time
+   * @param[in] xyz  Coordinates
+   * @return Transformation matrix
+   */
+  KOKKOS_FUNCTION
+  virtual mm::TransMatType
+  build_transformation(const double& time, const mm::ThreeDVecType& xyz);
+
+  /** Function to compute motion-specific velocity
+   *
+   * @param[in]  time      Current time
+   * @param[in]  compTrans Transformation matrix
+   *                       including all motions
+   * @param[in]  mxyz      Model coordinates
+   * @param[in]  cxyz      Transformed coordinates
+   * @return Velocity vector associated with coordinates
+   */
+  KOKKOS_FUNCTION
+  virtual mm::ThreeDVecType compute_velocity(
+    const double& time,
+    const mm::TransMatType& compTrans,
+    const mm::ThreeDVecType& mxyz,
+    const mm::ThreeDVecType& cxyz);
+
+  /** Set the pose and velocities of the body
+   *
+   * @param[in] displacement Displacement of the center of mass
+   * @param[in] quaternion   Orientation (w, x, y, z) relative to the model
+   *                         configuration
+   * @param[in] velocity     Velocity of the center of mass
+   * @param[in] omega        Angular velocity
+   */
+  void set_state(
+    const mm::ThreeDVecType& displacement,
+    const double* quaternion,
+    const mm::ThreeDVecType& velocity,
+    const mm::ThreeDVecType& omega);
+
+  //! Center of mass in the model configuration
+  const mm::ThreeDVecType& centroid() const { return origin_; }
+
+private:
+  void load(const YAML::Node&);
+
+  mm::ThreeDVecType displacement_;
+  mm::ThreeDVecType velocity_;
+  mm::ThreeDVecType omega_;
+
+  double quat_[4]{1.0, 0.0, 0.0, 0.0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* MOTIONSIXDOFKERNEL_H */
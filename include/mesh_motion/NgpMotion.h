@@ -165,6 +165,16 @@ public:
 
   bool is_deforming() { return isDeforming_; }
 
+  /** Flag denoting whether the transformation matrix is independent of the
+   *  nodal coordinates, i.e., it can be built once per time step
+   */
+  bool is_node_independent() const { return isNodeIndependent_; }
+
+  /** Flag denoting whether the motion is a rigid-body motion, i.e., its
+   *  transformation only rotates and translates
+   */
+  bool is_rigid() const { return isRigid_; }
+
 protected:
   /** Centroid
    *
@@ -177,6 +187,10 @@ protected:
   double endTime_{DBL_MAX};
 
   bool isDeforming_ = false;
+
+  bool isNodeIndependent_ = false;
+
+  bool isRigid_ = false;
 };
 
 template <typename T>
@@ -189,8 +203,11 @@ public:
 
   virtual NgpMotion* create_on_device() final
   {
-    free_on_device();
-    deviceCopy_ = nalu_ngp::create<T>(*dynamic_cast<T*>(this));
+    // reuse the existing device allocation; only the state is updated
+    if (deviceCopy_ == nullptr)
+      deviceCopy_ = nalu_ngp::create<T>(*dynamic_cast<T*>(this));
+    else
+      nalu_ngp::recreate<T>(deviceCopy_, *dynamic_cast<T*>(this));
     return deviceCopy_;
   }
 
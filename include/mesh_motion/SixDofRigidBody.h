@@ -0,0 +1,129 @@
+#ifndef SIXDOFRIGIDBODY_H
+#define SIXDOFRIGIDBODY_H
+
+#include "mesh_motion/MotionSixDofKernel.h"
+
+#include "stk_mesh/base/MetaData.hpp"
+#include "stk_mesh/base/Part.hpp"
+
+namespace sierra {
+namespace nalu {
+
+/** Rigid-body dynamics of a floating or freely moving body
+ *
+ *  Integrates the Newton-Euler equations of the body with the trapezoidal
+ *  rule from the fluid loads on its surface parts and sets the resulting pose
+ *  on the associated MotionSixDofKernel. Within a time step the integration
+ *  can be repeated (implicit sub-iterations) with under-relaxed loads of the
+ *  latest flow iterate, always starting from the state of the previous time
+ *  step.
+ */
+class SixDofRigidBody
+{
+public:
+  //! Size of the load vector: force and moment about the center of mass
+  static constexpr int numLoads = 6;
+
+  SixDofRigidBody(
+    stk::mesh::MetaData&, const YAML::Node&, MotionSixDofKernel& kernel);
+
+  ~SixDofRigidBody() = default;
+
+  /** Start a new time step
+   *
+   *  Accepts the state of the previous time step and predicts the new one
+   *  assuming the loads do not change over the time step.
+   *
+   * @param[in] time  Time at the new time level
+   * @param[in] dt    Time step
+   * @param[in] loads Force and moment acting on the body at the old time level
+   */
+  void predict(const double time, const double dt, const double* loads);
+
+  /** Sub-iteration within the time step
+   *
+   * @param[in] dt    Time step
+   * @param[in] loads Force and moment from the latest flow iterate
+   */
+  void correct(const double dt, const double* loads);
+
+  //! Current position of the center of mass
+  mm::ThreeDVecType centroid() const;
+
+  //! Current velocity of the center of mass
+  const mm::ThreeDVecType& velocity() const { return stateNp1_.vel; }
+
+  //! Current angular velocity
+  const mm::ThreeDVecType& omega() const { return stateNp1_.omega; }
+
+  //! Current orientation (w, x, y, z) relative to the model configuration
+  const double* quaternion() const { return stateNp1_.quat; }
+
+  //! Surface parts the fluid loads are integrated over
+  const stk::mesh::PartVector& surface_parts() const { return surfaceParts_; }
+
+  //! Flag denoting whether the body is coupled through sub-iterations
+  bool implicit_coupling() const { return implicitCoupling_; }
+
+private:
+  SixDofRigidBody() = delete;
+  SixDofRigidBody(const SixDofRigidBody&) = delete;
+
+  struct BodyState
+  {
+    mm::ThreeDVecType disp;
+    mm::ThreeDVecType vel;
+    mm::ThreeDVecType omega;
+    double quat[4]{1.0, 0.0, 0.0, 0.0};
+  };
+
+  void load(stk::mesh::MetaData&, const YAML::Node&);
+
+  void integrate(const double dt);
+
+  //! Inverse inertia tensor in the current orientation
+  void inverse_world_inertia(const double* quat, double* invInertia) const;
+
+  //! Angular momentum in the current orientation
+  void angular_momentum(const BodyState& state, double* angMom) const;
+
+  //! Push the current state to the motion kernel
+  void update_kernel();
+
+  MotionSixDofKernel& kernel_;
+
+  stk::mesh::PartVector surfaceParts_;
+
+  double mass_{1.0};
+
+  //! Inertia tensor about the center of mass in the model configuration
+  double inertia_[9]{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+  double invInertia_[9]{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+
+  mm::ThreeDVecType gravity_;
+
+  //! Masks of the translational and rotational degrees of freedom
+  double transDofs_[3]{1.0, 1.0, 1.0};
+  double rotDofs_[3]{1.0, 1.0, 1.0};
+
+  //! Under-relaxation of the loads between sub-iterations
+  double relaxation_{1.0};
+
+  double startTime_{0.0};
+
+  bool implicitCoupling_{true};
+
+  //! Body is moving, i.e., the start time has been reached
+  bool isActive_{false};
+
+  BodyState stateN_;
+  BodyState stateNp1_;
+
+  double loadsN_[numLoads]{0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  double loadsNp1_[numLoads]{0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* SIXDOFRIGIDBODY_H */
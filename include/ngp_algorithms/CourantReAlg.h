@@ -12,6 +12,7 @@
 
 #include "Algorithm.h"
 #include "ElemDataRequests.h"
+#include "ElemDataRequestsGPU.h"
 #include "FieldTypeDef.h"
 
 #include "stk_mesh/base/Types.hpp"
@@ -37,6 +38,9 @@ private:
 
   ElemDataRequests elemData_;
 
+  //! Device copy of elemData_ reused across time steps
+  ElemDataRequestsGPUCache elemDataNGP_;
+
   const unsigned coordinates_{stk::mesh::InvalidOrdinal};
   const unsigned velocity_{stk::mesh::InvalidOrdinal};
   const unsigned density_{stk::mesh::InvalidOrdinal};
@@ -44,6 +48,9 @@ private:
   const unsigned elemCFL_{stk::mesh::InvalidOrdinal};
   const unsigned elemRe_{stk::mesh::InvalidOrdinal};
 
+  //! Nodal inverse time scale for local time stepping, if active
+  const unsigned localDt_{stk::mesh::InvalidOrdinal};
+
   MasterElement* meSCS_{nullptr};
 };
 
@@ -29,8 +29,16 @@ public:
   void update_max_cfl_rey(const double cfl, const double rey);
 
 private:
+  //! Convert the nodal inverse time scales into local pseudo time steps
+  void compute_local_time_step();
+
   double maxCFL_;
   double maxRe_;
+
+  //! Switched evolution relaxation of the local time step Courant number
+  double serCourant_;
+  double prevNorm_{0.0};
+  int serStep_{-1};
 };
 
 } // namespace nalu
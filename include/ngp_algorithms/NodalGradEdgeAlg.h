@@ -33,8 +33,18 @@ class NodalGradEdgeAlg : public Algorithm
 public:
   using DblType = double;
 
+  /** Edge-based Green-Gauss gradient
+   *
+   *  When an `activeNodes` field is provided, only edges with at least one
+   *  node where the field is non-zero contribute to the gradient. The caller
+   *  is responsible for the gradient at the remaining nodes.
+   */
   NodalGradEdgeAlg(
-    Realm&, stk::mesh::Part*, PhiType* phi, GradPhiType* gradPhi);
+    Realm&,
+    stk::mesh::Part*,
+    PhiType* phi,
+    GradPhiType* gradPhi,
+    ScalarFieldType* activeNodes = nullptr);
 
   virtual ~NodalGradEdgeAlg() = default;
 
@@ -43,6 +53,7 @@ public:
 private:
   unsigned phi_{stk::mesh::InvalidOrdinal};
   unsigned gradPhi_{stk::mesh::InvalidOrdinal};
+  unsigned activeNodes_{stk::mesh::InvalidOrdinal};
 
   unsigned edgeAreaVec_{stk::mesh::InvalidOrdinal};
   unsigned dualNodalVol_{stk::mesh::InvalidOrdinal};
@@ -12,6 +12,7 @@
 
 #include "Algorithm.h"
 #include "FieldTypeDef.h"
+#include "utils/AMSUtils.h"
 
 #include "stk_mesh/base/Types.hpp"
 
@@ -43,6 +44,7 @@ private:
   const bool lengthScaleLimiter_;
   const std::vector<double> eastVector_;
   const std::vector<double> northVector_;
+  ams_utils::ForcingConstants forcingConsts_;
 
   unsigned velocity_{stk::mesh::InvalidOrdinal};
   unsigned density_{stk::mesh::InvalidOrdinal};
@@ -67,6 +69,8 @@ private:
   unsigned Mij_{stk::mesh::InvalidOrdinal};
   unsigned wallDist_{stk::mesh::InvalidOrdinal};
   unsigned coordinates_{stk::mesh::InvalidOrdinal};
+  unsigned forcingBasis_{stk::mesh::InvalidOrdinal};
+  unsigned forcingCoeff_{stk::mesh::InvalidOrdinal};
 
   // Proper definition of beta_kol in SST-AMS doesn't work
   // near walls, so emprically tested floor is used currently
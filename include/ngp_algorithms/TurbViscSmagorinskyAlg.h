@@ -0,0 +1,48 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef TurbViscSmagorinskyAlg_h
+#define TurbViscSmagorinskyAlg_h
+
+#include "Algorithm.h"
+#include "FieldTypeDef.h"
+
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+class TurbViscSmagorinskyAlg : public Algorithm
+{
+public:
+  using DblType = double;
+
+  TurbViscSmagorinskyAlg(
+    Realm& realm, stk::mesh::Part* part, ScalarFieldType* tvisc);
+
+  virtual ~TurbViscSmagorinskyAlg() = default;
+
+  virtual void execute() override;
+
+private:
+  ScalarFieldType* tviscField_{nullptr};
+  unsigned dudx_{stk::mesh::InvalidOrdinal};
+  unsigned density_{stk::mesh::InvalidOrdinal};
+  unsigned tvisc_{stk::mesh::InvalidOrdinal};
+  unsigned dualNodalVolume_{stk::mesh::InvalidOrdinal};
+
+  const DblType cmuCs_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
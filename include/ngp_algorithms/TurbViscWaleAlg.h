@@ -0,0 +1,47 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef TurbViscWaleAlg_h
+#define TurbViscWaleAlg_h
+
+#include "Algorithm.h"
+#include "FieldTypeDef.h"
+
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+class TurbViscWaleAlg : public Algorithm
+{
+public:
+  using DblType = double;
+
+  TurbViscWaleAlg(Realm& realm, stk::mesh::Part* part, ScalarFieldType* tvisc);
+
+  virtual ~TurbViscWaleAlg() = default;
+
+  virtual void execute() override;
+
+private:
+  ScalarFieldType* tviscField_{nullptr};
+  unsigned dudx_{stk::mesh::InvalidOrdinal};
+  unsigned density_{stk::mesh::InvalidOrdinal};
+  unsigned tvisc_{stk::mesh::InvalidOrdinal};
+  unsigned dualNodalVolume_{stk::mesh::InvalidOrdinal};
+
+  const DblType Cw_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -0,0 +1,73 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef WALLFRICVELALG_H
+#define WALLFRICVELALG_H
+
+#include "Algorithm.h"
+#include "ElemDataRequests.h"
+#include "NaluParsedTypes.h"
+#include "SimdInterface.h"
+
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+/** Compute the wall friction velocity at the integration points of a wall
+ *  boundary using the log-law wall function
+ *
+ *  The wall normal distance at the integration points
+ *  ("wall_normal_distance_bip") is computed once per mesh update by
+ *  WallFuncGeometryAlg, so this algorithm only gathers the flow fields on the
+ *  face and solves for utau at every integration point.
+ *
+ *  \sa WallFuncGeometryAlg, WallFricVelAlgDriver
+ */
+template <typename BcAlgTraits>
+class WallFricVelAlg : public Algorithm
+{
+public:
+  WallFricVelAlg(
+    Realm&, stk::mesh::Part*, const bool, const WallBoundaryConditionData&);
+
+  virtual ~WallFricVelAlg() = default;
+
+  virtual void execute() override;
+
+private:
+  ElemDataRequests faceData_;
+
+  unsigned velocityNp1_{stk::mesh::InvalidOrdinal};
+  unsigned bcVelocity_{stk::mesh::InvalidOrdinal};
+  unsigned density_{stk::mesh::InvalidOrdinal};
+  unsigned viscosity_{stk::mesh::InvalidOrdinal};
+  unsigned exposedAreaVec_{stk::mesh::InvalidOrdinal};
+  unsigned wallFricVel_{stk::mesh::InvalidOrdinal};
+  unsigned wallNormDist_{stk::mesh::InvalidOrdinal};
+
+  const double yplusCrit_{11.63};
+  const double elog_{9.8};
+  const double kappa_;
+
+  //! RANS ABL approach uses a fixed Monin-Obukhov estimate of utau
+  bool RANSAblBcApproach_{false};
+  double uRef_{0.0};
+  double zRef_{0.0};
+  double z0_{0.0};
+
+  const bool useShifted_;
+
+  MasterElement* meFC_{nullptr};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* WALLFRICVELALG_H */
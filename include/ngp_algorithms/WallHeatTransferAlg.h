@@ -0,0 +1,65 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef WALLHEATTRANSFERALG_H
+#define WALLHEATTRANSFERALG_H
+
+#include "Algorithm.h"
+#include "ElemDataRequests.h"
+#include "SimdInterface.h"
+
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+/** Compute the wall heat transfer coefficient, reference temperature, normal
+ *  heat flux and Robin coupling parameter at the nodes of a wall boundary
+ *
+ *  The area-weighted contributions of the boundary integration points are
+ *  accumulated to the nearest nodes; parallel assembly and normalization is
+ *  performed by WallHeatTransferAlgDriver.
+ *
+ *  \sa WallHeatTransferAlgDriver
+ */
+template <typename BcAlgTraits>
+class WallHeatTransferAlg : public Algorithm
+{
+public:
+  WallHeatTransferAlg(Realm&, stk::mesh::Part*);
+
+  virtual ~WallHeatTransferAlg() = default;
+
+  virtual void execute() override;
+
+private:
+  ElemDataRequests faceData_;
+  ElemDataRequests elemData_;
+
+  unsigned coordinates_{stk::mesh::InvalidOrdinal};
+  unsigned temperature_{stk::mesh::InvalidOrdinal};
+  unsigned dhdx_{stk::mesh::InvalidOrdinal};
+  unsigned density_{stk::mesh::InvalidOrdinal};
+  unsigned thermalCond_{stk::mesh::InvalidOrdinal};
+  unsigned specificHeat_{stk::mesh::InvalidOrdinal};
+  unsigned exposedAreaVec_{stk::mesh::InvalidOrdinal};
+  unsigned wallArea_{stk::mesh::InvalidOrdinal};
+  unsigned referenceTemperature_{stk::mesh::InvalidOrdinal};
+  unsigned heatTransferCoeff_{stk::mesh::InvalidOrdinal};
+  unsigned normalHeatFlux_{stk::mesh::InvalidOrdinal};
+  unsigned robinCouplingParam_{stk::mesh::InvalidOrdinal};
+
+  MasterElement* meFC_{nullptr};
+  MasterElement* meSCS_{nullptr};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* WALLHEATTRANSFERALG_H */
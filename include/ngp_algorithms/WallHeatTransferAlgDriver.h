@@ -0,0 +1,42 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef WALLHEATTRANSFERALGDRIVER_H
+#define WALLHEATTRANSFERALGDRIVER_H
+
+#include "ngp_algorithms/NgpAlgDriver.h"
+#include "FieldTypeDef.h"
+
+namespace sierra {
+namespace nalu {
+
+/** Driver for the wall heat transfer (conjugate heat transfer) quantities
+ *
+ *  Resets the nodal fields before the topology-specific algorithms accumulate
+ *  their contributions, then performs the parallel/periodic assembly and the
+ *  area normalization on device.
+ *
+ *  \sa WallHeatTransferAlg
+ */
+class WallHeatTransferAlgDriver : public NgpAlgDriver
+{
+public:
+  WallHeatTransferAlgDriver(Realm&);
+
+  virtual ~WallHeatTransferAlgDriver() = default;
+
+  virtual void pre_work() override;
+
+  virtual void post_work() override;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* WALLHEATTRANSFERALGDRIVER_H */
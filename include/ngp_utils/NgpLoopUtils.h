@@ -94,6 +94,26 @@ ngp_calc_thread_shmem_size(
   return (faceMemSize + elemMemSize);
 }
 
+/** Device copy of element data requests for the NGP loops
+ *
+ *  Host requests are copied to the device for every loop; callers that reuse
+ *  the device copy across executions can pass an ElemDataRequestsGPU instead.
+ */
+template <typename FieldManager>
+inline ElemDataRequestsGPU
+ngp_elem_data_requests(
+  const FieldManager& fieldMgr, const ElemDataRequests& dataReqs)
+{
+  return ElemDataRequestsGPU(fieldMgr, dataReqs);
+}
+
+template <typename FieldManager>
+inline const ElemDataRequestsGPU&
+ngp_elem_data_requests(const FieldManager&, const ElemDataRequestsGPU& dataReqs)
+{
+  return dataReqs;
+}
+
 } // namespace impl
 
 /** Execute the given functor for all entities in a Kokkos parallel loop
@@ -337,7 +357,7 @@ run_elem_algorithm(
   const auto& ngpMesh = meshInfo.ngp_mesh();
   const auto& fieldMgr = meshInfo.ngp_field_manager();
 
-  ElemDataRequestsGPU dataReqNGP(fieldMgr, dataReqs);
+  const auto& dataReqNGP = impl::ngp_elem_data_requests(fieldMgr, dataReqs);
 
   const int nodesPerElement = nodes_per_entity(dataReqNGP);
   NGP_ThrowRequire(nodesPerElement != 0);
@@ -433,7 +453,7 @@ run_elem_par_reduce(
   const auto& ngpMesh = meshInfo.ngp_mesh();
   const auto& fieldMgr = meshInfo.ngp_field_manager();
 
-  ElemDataRequestsGPU dataReqNGP(fieldMgr, dataReqs);
+  const auto& dataReqNGP = impl::ngp_elem_data_requests(fieldMgr, dataReqs);
 
   const int nodesPerElement = nodes_per_entity(dataReqNGP);
   NGP_ThrowRequire(nodesPerElement != 0);
@@ -519,8 +539,10 @@ run_face_elem_algorithm(
   const auto& ngpMesh = meshInfo.ngp_mesh();
   const auto& fieldMgr = meshInfo.ngp_field_manager();
 
-  ElemDataRequestsGPU faceDataNGP(fieldMgr, faceDataReqs);
-  ElemDataRequestsGPU elemDataNGP(fieldMgr, elemDataReqs);
+  const auto& faceDataNGP =
+    impl::ngp_elem_data_requests(fieldMgr, faceDataReqs);
+  const auto& elemDataNGP =
+    impl::ngp_elem_data_requests(fieldMgr, elemDataReqs);
 
   const int nodesPerElement = nodes_per_entity(elemDataNGP);
   const int nodesPerFace = nodes_per_entity(faceDataNGP, METype::FACE);
@@ -643,8 +665,10 @@ run_face_elem_par_reduce(
   const auto& ngpMesh = meshInfo.ngp_mesh();
   const auto& fieldMgr = meshInfo.ngp_field_manager();
 
-  ElemDataRequestsGPU faceDataNGP(fieldMgr, faceDataReqs);
-  ElemDataRequestsGPU elemDataNGP(fieldMgr, elemDataReqs);
+  const auto& faceDataNGP =
+    impl::ngp_elem_data_requests(fieldMgr, faceDataReqs);
+  const auto& elemDataNGP =
+    impl::ngp_elem_data_requests(fieldMgr, elemDataReqs);
 
   const int nodesPerElement = nodes_per_entity(elemDataNGP);
   const int nodesPerFace = nodes_per_entity(faceDataNGP, METype::FACE);
@@ -771,8 +795,10 @@ run_face_elem_algorithm_nosimd(
   const auto& ngpMesh = meshInfo.ngp_mesh();
   const auto& fieldMgr = meshInfo.ngp_field_manager();
 
-  ElemDataRequestsGPU faceDataNGP(fieldMgr, faceDataReqs);
-  ElemDataRequestsGPU elemDataNGP(fieldMgr, elemDataReqs);
+  const auto& faceDataNGP =
+    impl::ngp_elem_data_requests(fieldMgr, faceDataReqs);
+  const auto& elemDataNGP =
+    impl::ngp_elem_data_requests(fieldMgr, elemDataReqs);
 
   const int nodesPerElement = nodes_per_entity(elemDataNGP);
   const int nodesPerFace = nodes_per_entity(faceDataNGP, METype::FACE);
@@ -54,6 +54,7 @@ private:
   stk::mesh::NgpField<double> dnvNp1_;
   stk::mesh::NgpField<double> dnvN_;
   stk::mesh::NgpField<double> dnvNm1_;
+  stk::mesh::NgpField<double> localDt_;
 
   unsigned velocityNm1ID_{stk::mesh::InvalidOrdinal};
   unsigned velocityNID_{stk::mesh::InvalidOrdinal};
@@ -65,8 +66,11 @@ private:
   unsigned dnvNp1ID_{stk::mesh::InvalidOrdinal};
   unsigned dnvNID_{stk::mesh::InvalidOrdinal};
   unsigned dnvNm1ID_{stk::mesh::InvalidOrdinal};
+  unsigned localDtID_{stk::mesh::InvalidOrdinal};
 
   double dt_;
+  //! Pseudo time step per node instead of dt_ (local time stepping)
+  bool useLocalDt_{false};
   int nDim_;
   double gamma1_, gamma2_, gamma3_;
 };
@@ -17,14 +17,18 @@
 #include "stk_mesh/base/NgpField.hpp"
 #include "stk_mesh/base/Types.hpp"
 
-using DoubleView = Kokkos::View<double*, sierra::nalu::MemSpace>;
-using DoubleViewHost = DoubleView::HostMirror;
-
 namespace sierra {
 namespace nalu {
 
 class SolutionOptions;
 
+/** SST-AMS momentum forcing
+ *
+ *  The velocity-independent forcing field and coefficient are computed by the
+ *  AMS averaging pass (see SSTAMSAveragesAlg); this kernel scales them with
+ *  the current turbulent viscosity, which is recomputed after that pass, and
+ *  applies the forcing where it does not remove resolved energy.
+ */
 class MomentumSSTAMSForcingNodeKernel
   : public NGPNodeKernel<MomentumSSTAMSForcingNodeKernel>
 {
@@ -47,57 +51,23 @@ public:
 
 private:
   stk::mesh::NgpField<double> dualNodalVolume_;
-
-  stk::mesh::NgpField<double> coordinates_;
   stk::mesh::NgpField<double> velocity_;
-  stk::mesh::NgpField<double> viscosity_;
-  stk::mesh::NgpField<double> tvisc_;
-  stk::mesh::NgpField<double> density_;
-  stk::mesh::NgpField<double> tke_;
-  stk::mesh::NgpField<double> sdr_;
-  stk::mesh::NgpField<double> beta_;
-  stk::mesh::NgpField<double> Mij_;
-  stk::mesh::NgpField<double> minDist_;
   stk::mesh::NgpField<double> avgVelocity_;
-  stk::mesh::NgpField<double> avgTime_;
-  stk::mesh::NgpField<double> avgResAdeq_;
+  stk::mesh::NgpField<double> tvisc_;
+  stk::mesh::NgpField<double> forcingBasis_;
+  stk::mesh::NgpField<double> forcingCoeff_;
   stk::mesh::NgpField<double> forcingComp_;
 
   unsigned dualNodalVolumeID_{stk::mesh::InvalidOrdinal};
-  unsigned coordinatesID_{stk::mesh::InvalidOrdinal};
   unsigned velocityID_{stk::mesh::InvalidOrdinal};
-  unsigned viscosityID_{stk::mesh::InvalidOrdinal};
-  unsigned turbViscID_{stk::mesh::InvalidOrdinal};
-  unsigned densityNp1ID_{stk::mesh::InvalidOrdinal};
-  unsigned tkeNp1ID_{stk::mesh::InvalidOrdinal};
-  unsigned sdrNp1ID_{stk::mesh::InvalidOrdinal};
-  unsigned betaID_{stk::mesh::InvalidOrdinal};
-  unsigned MijID_{stk::mesh::InvalidOrdinal};
-  unsigned minDistID_{stk::mesh::InvalidOrdinal};
   unsigned avgVelocityID_{stk::mesh::InvalidOrdinal};
-  unsigned avgResAdeqID_{stk::mesh::InvalidOrdinal};
+  unsigned tviscID_{stk::mesh::InvalidOrdinal};
+  unsigned forcingBasisID_{stk::mesh::InvalidOrdinal};
+  unsigned forcingCoeffID_{stk::mesh::InvalidOrdinal};
   unsigned forcingCompID_{stk::mesh::InvalidOrdinal};
 
-  const double betaStar_;
-  const double forceCl_;
-  const double Ceta_;
-  const double Ct_;
-  const double blT_;
-  const double blKol_;
-  const double forceFactor_;
-  const double cMu_;
-  const double periodicForcingLengthX_;
-  const double periodicForcingLengthY_;
-  const double periodicForcingLengthZ_;
   const int nDim_;
-
-  double time_;
   double dt_;
-
-  bool RANSBelowKs_;
-  double z0_;
-  DoubleView eastVector_;
-  DoubleView northVector_;
 };
 
 } // namespace nalu
@@ -65,8 +65,11 @@ public:
 
   virtual NodeKernel* create_on_device() final
   {
-    free_on_device();
-    deviceCopy_ = nalu_ngp::create<T>(*dynamic_cast<T*>(this));
+    // reuse the existing device allocation; only the state is updated
+    if (deviceCopy_ == nullptr)
+      deviceCopy_ = nalu_ngp::create<T>(*dynamic_cast<T*>(this));
+    else
+      nalu_ngp::recreate<T>(deviceCopy_, *dynamic_cast<T*>(this));
     return deviceCopy_;
   }
 
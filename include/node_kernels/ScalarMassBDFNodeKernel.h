@@ -52,6 +52,7 @@ private:
   stk::mesh::NgpField<double> dnvNp1_;
   stk::mesh::NgpField<double> dnvN_;
   stk::mesh::NgpField<double> dnvNm1_;
+  stk::mesh::NgpField<double> localDt_;
 
   unsigned scalarQNm1ID_{stk::mesh::InvalidOrdinal};
   unsigned scalarQNID_{stk::mesh::InvalidOrdinal};
@@ -62,8 +63,11 @@ private:
   unsigned dnvNp1ID_{stk::mesh::InvalidOrdinal};
   unsigned dnvNID_{stk::mesh::InvalidOrdinal};
   unsigned dnvNm1ID_{stk::mesh::InvalidOrdinal};
+  unsigned localDtID_{stk::mesh::InvalidOrdinal};
 
   double dt_;
+  //! Pseudo time step per node instead of dt_ (local time stepping)
+  bool useLocalDt_{false};
   double gamma1_, gamma2_, gamma3_;
 };
 
@@ -12,6 +12,8 @@
 
 #include <SimdInterface.h>
 
+#include <cmath>
+
 namespace sierra {
 namespace nalu {
 
@@ -58,6 +60,103 @@ get_M43_constant(T D[dim][dim], const double CMdeg)
   return poly * CMdeg;
 }
 
+//! Model constants of the SST-AMS momentum forcing
+struct ForcingConstants
+{
+  double betaStar;
+  double forceCl;
+  double Ceta;
+  double Ct;
+  double blT;
+  double blKol;
+  double forceFactor;
+  double cMu;
+  double periodicLength[3];
+};
+
+/** Velocity-independent part of the SST-AMS momentum forcing
+ *
+ *  Computes the scaled Taylor-Green forcing field `basis` and returns the
+ *  resolution-adequacy coefficient. The forcing target scales with
+ *  sqrt(tvisc), which is recomputed after the averaging pass, so `basis`
+ *  excludes that factor. The forcing is `coeff * sqrt(tvisc) * basis`
+ *  wherever it does not remove resolved energy, i.e., `basis * u' >= 0`.
+ */
+template <class T>
+KOKKOS_FUNCTION T
+forcing_basis(
+  const ForcingConstants& c,
+  const double time,
+  const T* coords,
+  const T* avgU,
+  const T mu,
+  const T rho,
+  const T tkeIn,
+  const T sdr,
+  const T beta,
+  const T wallDist,
+  const T avgResAdeq,
+  T* basis)
+{
+  const T tke = stk::math::max(tkeIn, 1.0e-12);
+  const T eps = c.betaStar * tke * sdr;
+
+  const T smallCl = 2.0;
+  const T clOffset = 0.2;
+
+  T length = (c.forceCl + (1.0 - stk::math::max(beta, 1.0 - clOffset)) /
+                            clOffset * (smallCl - c.forceCl)) *
+             stk::math::pow(beta * tke, 1.5) / eps;
+  length = stk::math::max(
+    length,
+    c.Ceta * (stk::math::pow(mu / rho, 0.75) / stk::math::pow(eps, 0.25)));
+
+  const T lengthY = stk::math::min(length, wallDist);
+
+  T T_beta = beta * tke / eps;
+  T_beta = stk::math::max(T_beta, c.Ct * stk::math::sqrt(mu / rho / eps));
+  T_beta = c.blT * T_beta;
+
+  // FIXME : Make this aware of wall direction, for now it is
+  //         generalized using lengthY for all directions
+  T arg[3];
+  for (int d = 0; d < 3; ++d) {
+    const T clipLength = stk::math::min(lengthY, c.periodicLength[d]);
+    const T ratio =
+      std::floor(c.periodicLength[d] / (clipLength + 1.e-12) + 0.5);
+    const T a = M_PI / (c.periodicLength[d] / ratio);
+    arg[d] = a * (coords[d] + avgU[d] * time);
+  }
+
+  // Taylor-Green field scaled by the target forcing magnitude per sqrt(tvisc)
+  const T v2PerTvisc = c.betaStar * sdr / (c.cMu * rho);
+  const T F_target =
+    c.forceFactor * stk::math::sqrt(beta * v2PerTvisc) / T_beta;
+
+  const T hX = 1. / 3. * stk::math::cos(arg[0]) * stk::math::sin(arg[1]) *
+               stk::math::sin(arg[2]);
+  const T hY = -1. * stk::math::sin(arg[0]) * stk::math::cos(arg[1]) *
+               stk::math::sin(arg[2]);
+  const T hZ = 2. / 3. * stk::math::sin(arg[0]) * stk::math::sin(arg[1]) *
+               stk::math::cos(arg[2]);
+  basis[0] = F_target * hX;
+  basis[1] = F_target * hY;
+  basis[2] = F_target * hZ;
+
+  const T b_kol =
+    stk::math::min(c.blKol * stk::math::sqrt(mu * eps / rho) / tke, 1.0);
+
+  const T bhat = stk::math::if_then_else(
+    (1.0 - b_kol) > 0.0, (1.0 - beta) / (1.0 - b_kol), 10000.0);
+
+  const T C_F = -1.0 * stk::math::tanh(
+                         1.0 - 1.0 / stk::math::sqrt(
+                                       stk::math::min(avgResAdeq, 1.0)));
+
+  return C_F * (1.0 - stk::math::min(
+                        stk::math::tanh(10.0 * (bhat - 1.0)) + 1.0, 1.0));
+}
+
 } // namespace ams_utils
 
 } // namespace nalu
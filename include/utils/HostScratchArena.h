@@ -0,0 +1,178 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+#ifndef HOSTSCRATCHARENA_H_
+#define HOSTSCRATCHARENA_H_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Bump allocator for host scratch memory
+ *
+ *  Memory is handed out from slabs that are kept for the lifetime of the
+ *  arena, i.e., once the high-water mark has been reached algorithms do not
+ *  allocate from the heap anymore. Allocations are released by rewinding the
+ *  arena, usually through a HostScratchScope.
+ */
+class HostScratchArena
+{
+public:
+  static constexpr size_t defaultSlabBytes = 1 << 16;
+  static constexpr size_t alignment = 64;
+
+  //! Position in the arena allocations can be rewound to
+  struct Marker
+  {
+    size_t slab{0};
+    size_t offset{0};
+  };
+
+  explicit HostScratchArena(const size_t slabBytes = defaultSlabBytes);
+
+  ~HostScratchArena() = default;
+
+  /** Allocate value-initialized scratch for `n` objects
+   *
+   *  Only trivially destructible types are supported since the arena never
+   *  runs destructors.
+   */
+  template <typename T>
+  T* allocate(const size_t n)
+  {
+    static_assert(
+      std::is_trivially_destructible<T>::value,
+      "HostScratchArena only supports trivially destructible types");
+    void* mem = allocate_bytes(n * sizeof(T));
+    T* ptr = static_cast<T*>(mem);
+    for (size_t i = 0; i < n; ++i)
+      new (ptr + i) T();
+    return ptr;
+  }
+
+  Marker mark() const { return Marker{currentSlab_, offset_}; }
+
+  void rewind(const Marker& marker);
+
+  //! Release all allocations; the slabs are kept for reuse
+  void reset() { rewind(Marker{}); }
+
+  //! Number of scratch requests served by the arena
+  size_t num_requests() const { return numRequests_; }
+
+  //! Number of slabs obtained from the heap
+  size_t num_slab_allocations() const { return slabs_.size(); }
+
+  //! Maximum number of bytes in use at any time
+  size_t high_water_mark() const { return highWaterMark_; }
+
+private:
+  HostScratchArena(const HostScratchArena&) = delete;
+  HostScratchArena& operator=(const HostScratchArena&) = delete;
+
+  void* allocate_bytes(const size_t bytes);
+
+  struct Slab
+  {
+    std::unique_ptr<char[]> data;
+    char* begin;
+    size_t size;
+  };
+
+  const size_t slabBytes_;
+
+  std::vector<Slab> slabs_;
+
+  size_t currentSlab_{0};
+  size_t offset_{0};
+
+  //! Capacity of all slabs preceding the current one
+  size_t slabBase_{0};
+
+  size_t numRequests_{0};
+  size_t highWaterMark_{0};
+};
+
+/** Scoped use of a HostScratchArena
+ *
+ *  All allocations made through the scope are released when it goes out of
+ *  scope.
+ */
+class HostScratchScope
+{
+public:
+  explicit HostScratchScope(HostScratchArena& arena)
+    : arena_(arena), marker_(arena.mark())
+  {
+  }
+
+  ~HostScratchScope() { arena_.rewind(marker_); }
+
+  template <typename T>
+  T* allocate(const size_t n)
+  {
+    return arena_.template allocate<T>(n);
+  }
+
+  //! Release the allocations of the scope, e.g., at the end of a loop body
+  void reset() { arena_.rewind(marker_); }
+
+private:
+  HostScratchScope(const HostScratchScope&) = delete;
+  HostScratchScope& operator=(const HostScratchScope&) = delete;
+
+  HostScratchArena& arena_;
+  const HostScratchArena::Marker marker_;
+};
+
+/** Per-realm collection of host scratch arenas
+ *
+ *  Every host thread obtains its own arena (slabs) so that scopes opened by
+ *  concurrent host loops do not interleave.
+ */
+class HostScratchPool
+{
+public:
+  HostScratchPool() = default;
+
+  ~HostScratchPool() = default;
+
+  //! Arena of the calling thread
+  HostScratchArena& arena();
+
+  //! Scratch requests served by all arenas; heap allocations without the pool
+  size_t num_requests() const;
+
+  //! Slabs obtained from the heap by all arenas
+  size_t num_slab_allocations() const;
+
+  //! Sum of the high-water marks of all arenas
+  size_t high_water_mark() const;
+
+private:
+  HostScratchPool(const HostScratchPool&) = delete;
+  HostScratchPool& operator=(const HostScratchPool&) = delete;
+
+  mutable std::mutex mutex_;
+
+  std::unordered_map<std::thread::id, std::unique_ptr<HostScratchArena>>
+    arenas_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* HOSTSCRATCHARENA_H_ */
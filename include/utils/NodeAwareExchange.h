@@ -0,0 +1,130 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+#ifndef NODEAWAREEXCHANGE_H_
+#define NODEAWAREEXCHANGE_H_
+
+#include "stk_mesh/base/Entity.hpp"
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+/** Node-aware summation of field values at shared mesh nodes
+ *
+ *  Ranks on the same compute node read each other's contributions from an
+ *  MPI-3 shared-memory window instead of exchanging MPI messages. Traffic to
+ *  other compute nodes is aggregated by the node leaders (node-local rank 0)
+ *  into a single message per pair of compute nodes.
+ *
+ *  Contributions are summed in ascending rank order, i.e., all ranks sharing
+ *  a node end up with bitwise identical values. The communication pattern is
+ *  rebuilt whenever the mesh has been modified.
+ */
+class NodeAwareExchange
+{
+public:
+  explicit NodeAwareExchange(const stk::mesh::BulkData& bulk);
+
+  ~NodeAwareExchange();
+
+  //! Sum the host values of the shared nodes over all sharing ranks
+  void parallel_sum(const std::vector<const stk::mesh::FieldBase*>& fields);
+
+  //! Number of ranks on the compute node of this rank
+  int ranks_per_node() const { return nodeSize_; }
+
+  //! Sharing ranks reached through shared memory
+  size_t num_intra_node_neighbors() const;
+
+  //! Sharing ranks on other compute nodes
+  size_t num_inter_node_neighbors() const;
+
+  //! Messages sent to other compute nodes during the last exchange
+  size_t num_inter_node_messages() const { return numInterNodeMessages_; }
+
+private:
+  NodeAwareExchange(const NodeAwareExchange&) = delete;
+  NodeAwareExchange& operator=(const NodeAwareExchange&) = delete;
+
+  //! Shared-memory window; segments are indexed by the node-local rank
+  struct SharedWindow
+  {
+    MPI_Win win{MPI_WIN_NULL};
+    size_t segmentBytes{0};
+    std::vector<char*> segments;
+  };
+
+  //! Sharing rank and the common nodes sorted by entity key
+  struct Neighbor
+  {
+    int rank;
+    bool intraNode;
+    std::vector<stk::mesh::Entity> nodes;
+  };
+
+  void build_pattern();
+
+  //! Collective over the compute node; grows the window if necessary
+  void reserve(SharedWindow& window, const size_t bytes, const bool leaderOnly);
+
+  void release(SharedWindow& window);
+
+  //! Make the segments written by the node-local ranks visible to all
+  void node_barrier(SharedWindow& window);
+
+  int neighbor_index(const int rank) const;
+
+  const stk::mesh::BulkData& bulk_;
+
+  MPI_Comm comm_;
+  MPI_Comm nodeComm_{MPI_COMM_NULL};
+  int rank_{0};
+  int nodeRank_{0};
+  int nodeSize_{1};
+
+  //! Compute node of every rank and the world rank of every node leader
+  std::vector<int> nodeOfRank_;
+  std::vector<int> leaderOfNode_;
+
+  //! World rank of the node-local ranks and vice versa (-1 if off-node)
+  std::vector<int> worldOfNodeRank_;
+  std::vector<int> nodeRankOfWorld_;
+
+  //! Sharing ranks in ascending order
+  std::vector<Neighbor> neighbors_;
+
+  //! Locally shared nodes sorted by entity key
+  std::vector<stk::mesh::Entity> sharedNodes_;
+
+  bool patternValid_{false};
+  size_t syncCount_{0};
+
+  SharedWindow outbox_;
+  SharedWindow inbox_;
+
+  std::vector<double> ownValues_;
+
+  size_t numInterNodeMessages_{0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* NODEAWAREEXCHANGE_H_ */
@@ -0,0 +1,50 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef SSTUPDATEANDCLIP_H
+#define SSTUPDATEANDCLIP_H
+
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/NgpMesh.hpp"
+#include "stk_mesh/base/Selector.hpp"
+
+namespace sierra {
+namespace nalu {
+
+//! Bounds applied to the SST transported quantities
+struct SSTClipLimits
+{
+  double tkeMin;
+  double sdrMin;
+  double gammaMin;
+  double gammaMax;
+};
+
+/** Add the linear solver increments to TKE, SDR and (optionally) gamma and
+ *  clip the result, in a single pass over the selected nodes
+ *
+ *  Negative TKE is reset to the minimum value, SDR is bounded from below and
+ *  gamma is bounded from both sides. Null increments skip the update and only
+ *  clip; a null `gamma` skips the intermittency altogether.
+ */
+void sst_update_and_clip(
+  const stk::mesh::NgpMesh& ngpMesh,
+  const stk::mesh::Selector& sel,
+  const SSTClipLimits& limits,
+  stk::mesh::NgpField<double>& tke,
+  stk::mesh::NgpField<double>& sdr,
+  stk::mesh::NgpField<double>* gamma = nullptr,
+  const stk::mesh::NgpField<double>* kTmp = nullptr,
+  const stk::mesh::NgpField<double>* wTmp = nullptr,
+  const stk::mesh::NgpField<double>* gamTmp = nullptr);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* SSTUPDATEANDCLIP_H */
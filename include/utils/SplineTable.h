@@ -0,0 +1,321 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef SPLINETABLE_H
+#define SPLINETABLE_H
+
+#include "KokkosInterface.h"
+
+#include "stk_math/StkMath.hpp"
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+namespace spline_detail {
+
+static constexpr int MaxOrder = 5;
+
+/** Nonzero B-spline basis functions of degree `order` at `x` in `span`
+ *
+ *  Algorithm A2.2 of "The NURBS Book" (Piegl & Tiller); `N` holds
+ *  `order + 1` values for the control points `span - order ... span`.
+ */
+KOKKOS_INLINE_FUNCTION
+void
+basis_functions(
+  const int order, const int span, const double x, const double* u, double* N)
+{
+  double left[MaxOrder + 1];
+  double right[MaxOrder + 1];
+  N[0] = 1.0;
+  for (int j = 1; j <= order; ++j) {
+    left[j] = x - u[span + 1 - j];
+    right[j] = u[span + j] - x;
+    double saved = 0.0;
+    for (int r = 0; r < j; ++r) {
+      const double temp = N[r] / (right[r + 1] + left[j - r]);
+      N[r] = saved + right[r + 1] * temp;
+      saved = left[j - r] * temp;
+    }
+    N[j] = saved;
+  }
+}
+
+//! Knots by averaging the data sites, eq. (9.8) of "The NURBS Book"
+std::vector<double>
+averaged_knots(const int order, const std::vector<double>& x);
+
+/** First bucket-to-span entry per bucket of a uniform grid over the knot
+ *  breakpoints; empty if the breakpoints are too irregular for buckets that
+ *  overlap at most two spans
+ */
+std::vector<int>
+span_buckets(const int order, const std::vector<double>& knots);
+
+/** Interpolation of `values` (first axis fastest) along axis `axis`, i.e.,
+ *  replaces the data on every grid line of that axis by the control points
+ */
+void solve_collocation(
+  const int order,
+  const std::vector<double>& x,
+  const std::vector<double>& knots,
+  const std::vector<int>& sizes,
+  const int axis,
+  std::vector<double>& values);
+
+} // namespace spline_detail
+
+/** Tensor-product B-spline table stored in flat views
+ *
+ *  Device-callable counterpart of the BSpline1D/2D/3D lookups in
+ *  tabular_props. The knots and control points of all axes live in single
+ *  views and each axis is a small POD record, so the table is captured by
+ *  value in node kernels. The control points vary fastest along the first
+ *  axis, like the dependent variables of the BSpline constructors.
+ *
+ *  The knot span is found from a uniform bucket grid over the breakpoints,
+ *  where a bucket overlaps at most two spans and selects pick the span, or
+ *  by bisection with a fixed number of steps when the breakpoints are too
+ *  irregular for the buckets. Neither path branches on the query. Queries
+ *  outside the table are clipped to its range.
+ */
+template <int Dim, typename MemorySpace = MemSpace>
+class SplineTable
+{
+public:
+  static_assert(Dim >= 1 && Dim <= 3, "SplineTable supports 1 to 3 inputs");
+
+  using ViewType = Kokkos::View<double*, Kokkos::LayoutRight, MemorySpace>;
+  using IntViewType = Kokkos::View<int*, Kokkos::LayoutRight, MemorySpace>;
+
+  struct Axis
+  {
+    int knotOffset;
+    int numCtrl;
+    //! -1 if the span is found by bisection
+    int bucketOffset;
+    int numBuckets;
+    int numSearchSteps;
+    double lo;
+    double hi;
+    double invBucketWidth;
+  };
+
+  SplineTable() = default;
+
+  /**
+   *  @param order : Polynomial degree, the spline has (order-1) continuous
+   *                 derivatives as for BSpline
+   *  @param knots : Knot vector of each axis
+   *  @param ctrlPts : Control points, first axis fastest
+   */
+  SplineTable(
+    const int order,
+    const std::array<std::vector<double>, Dim>& knots,
+    const std::vector<double>& ctrlPts);
+
+  KOKKOS_INLINE_FUNCTION
+  double value(const double* x) const
+  {
+    const int np = order_ + 1;
+    double N[Dim][spline_detail::MaxOrder + 1];
+    int first[Dim];
+    for (int d = 0; d < Dim; ++d) {
+      const Axis& ax = axes_[d];
+      const double xc = stk::math::min(stk::math::max(x[d], ax.lo), ax.hi);
+      const int span = find_span(ax, xc);
+      spline_detail::basis_functions(
+        order_, span, xc, knots_.data() + ax.knotOffset, N[d]);
+      first[d] = span - order_;
+    }
+
+    int numTerms = 1;
+    for (int d = 0; d < Dim; ++d)
+      numTerms *= np;
+
+    double sum = 0.0;
+    for (int m = 0; m < numTerms; ++m) {
+      int rem = m;
+      int idx = 0;
+      int stride = 1;
+      double w = 1.0;
+      for (int d = 0; d < Dim; ++d) {
+        const int i = rem % np;
+        rem /= np;
+        w *= N[d][i];
+        idx += (first[d] + i) * stride;
+        stride *= axes_[d].numCtrl;
+      }
+      sum += w * ctrl_(idx);
+    }
+    return sum;
+  }
+
+  int order() const { return order_; }
+
+  int num_ctrl(const int d) const { return axes_[d].numCtrl; }
+
+  bool uses_buckets(const int d) const { return axes_[d].bucketOffset >= 0; }
+
+private:
+  KOKKOS_INLINE_FUNCTION
+  int find_span(const Axis& ax, const double x) const
+  {
+    const double* u = knots_.data() + ax.knotOffset;
+    const int last = ax.numCtrl - 1;
+    if (ax.bucketOffset >= 0) {
+      int j = static_cast<int>((x - ax.lo) * ax.invBucketWidth);
+      j = (j < ax.numBuckets) ? j : ax.numBuckets - 1;
+      int span = buckets_(ax.bucketOffset + j);
+      // rounding of the bucket index can be off by one span either way
+      span -= (span > order_ && x < u[span]) ? 1 : 0;
+      span += (span < last && x >= u[span + 1]) ? 1 : 0;
+      return span;
+    }
+
+    int lo = order_;
+    int hi = ax.numCtrl;
+    for (int s = 0; s < ax.numSearchSteps; ++s) {
+      const int mid = (lo + hi) / 2;
+      const bool right = (x >= u[mid]);
+      lo = right ? mid : lo;
+      hi = right ? hi : mid;
+    }
+    return lo;
+  }
+
+  int order_{0};
+  Axis axes_[Dim];
+  ViewType knots_;
+  ViewType ctrl_;
+  IntViewType buckets_;
+};
+
+template <int Dim, typename MemorySpace>
+SplineTable<Dim, MemorySpace>::SplineTable(
+  const int order,
+  const std::array<std::vector<double>, Dim>& knots,
+  const std::vector<double>& ctrlPts)
+  : order_(order)
+{
+  if (order < 1 || order > spline_detail::MaxOrder)
+    throw std::runtime_error("SplineTable: unsupported spline order");
+
+  std::vector<double> allKnots;
+  std::vector<int> allBuckets;
+  size_t numCtrl = 1;
+  for (int d = 0; d < Dim; ++d) {
+    const auto& u = knots[d];
+    const int n = static_cast<int>(u.size()) - order - 1;
+    if (n <= order)
+      throw std::runtime_error(
+        "SplineTable: too few knots for the requested order");
+
+    Axis& ax = axes_[d];
+    ax.knotOffset = allKnots.size();
+    ax.numCtrl = n;
+    ax.lo = u[order];
+    ax.hi = u[n];
+
+    int steps = 0;
+    while ((1 << steps) < n - order)
+      ++steps;
+    ax.numSearchSteps = steps;
+
+    const auto buckets = spline_detail::span_buckets(order, u);
+    ax.numBuckets = buckets.size();
+    ax.bucketOffset =
+      buckets.empty() ? -1 : static_cast<int>(allBuckets.size());
+    ax.invBucketWidth =
+      buckets.empty() ? 0.0 : buckets.size() / (ax.hi - ax.lo);
+
+    allKnots.insert(allKnots.end(), u.begin(), u.end());
+    allBuckets.insert(allBuckets.end(), buckets.begin(), buckets.end());
+    numCtrl *= n;
+  }
+  if (ctrlPts.size() != numCtrl)
+    throw std::runtime_error(
+      "SplineTable: control points do not match the knot vectors");
+
+  knots_ = ViewType("spline_table_knots", allKnots.size());
+  ctrl_ = ViewType("spline_table_ctrl", ctrlPts.size());
+  buckets_ = IntViewType("spline_table_buckets", allBuckets.size());
+
+  auto hKnots = Kokkos::create_mirror_view(knots_);
+  auto hCtrl = Kokkos::create_mirror_view(ctrl_);
+  auto hBuckets = Kokkos::create_mirror_view(buckets_);
+  for (size_t i = 0; i < allKnots.size(); ++i)
+    hKnots(i) = allKnots[i];
+  for (size_t i = 0; i < ctrlPts.size(); ++i)
+    hCtrl(i) = ctrlPts[i];
+  for (size_t i = 0; i < allBuckets.size(); ++i)
+    hBuckets(i) = allBuckets[i];
+  Kokkos::deep_copy(knots_, hKnots);
+  Kokkos::deep_copy(ctrl_, hCtrl);
+  Kokkos::deep_copy(buckets_, hBuckets);
+}
+
+/** Interpolating table through data on a structured grid
+ *
+ *  @param order : Polynomial degree, see SplineTable
+ *  @param x : Data sites of each axis, strictly increasing
+ *  @param phi : Data at all points of the grid, first axis fastest
+ */
+template <int Dim, typename MemorySpace = MemSpace>
+SplineTable<Dim, MemorySpace>
+make_spline_table(
+  const int order,
+  const std::array<std::vector<double>, Dim>& x,
+  const std::vector<double>& phi)
+{
+  std::array<std::vector<double>, Dim> knots;
+  std::vector<int> sizes(Dim);
+  for (int d = 0; d < Dim; ++d) {
+    knots[d] = spline_detail::averaged_knots(order, x[d]);
+    sizes[d] = x[d].size();
+  }
+
+  std::vector<double> ctrlPts(phi);
+  for (int d = 0; d < Dim; ++d)
+    spline_detail::solve_collocation(
+      order, x[d], knots[d], sizes, d, ctrlPts);
+
+  return SplineTable<Dim, MemorySpace>(order, knots, ctrlPts);
+}
+
+/** Batched evaluation of a table, e.g., for all nodes of a part
+ *
+ *  @param x : Inputs indexed by (query, dimension)
+ *  @param phi : Table values for each query
+ */
+template <int Dim>
+void
+evaluate_spline_table(
+  const SplineTable<Dim>& table,
+  const Kokkos::View<const double**, Kokkos::LayoutRight, MemSpace>& x,
+  const Kokkos::View<double*, Kokkos::LayoutRight, MemSpace>& phi)
+{
+  Kokkos::parallel_for(
+    "evaluate_spline_table", DeviceRangePolicy(0, phi.extent(0)),
+    KOKKOS_LAMBDA(const int i) {
+      double xq[Dim];
+      for (int d = 0; d < Dim; ++d)
+        xq[d] = x(i, d);
+      phi(i) = table.value(xq);
+    });
+}
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* SPLINETABLE_H */
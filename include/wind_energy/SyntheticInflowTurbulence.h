@@ -0,0 +1,183 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef SYNTHETICINFLOWTURBULENCE_H
+#define SYNTHETICINFLOWTURBULENCE_H
+
+#include "Algorithm.h"
+#include "FieldTypeDef.h"
+#include "KokkosInterface.h"
+
+#include "stk_mesh/base/Types.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Digital filter generator of correlated random fluctuations on a plane
+ *
+ *  Follows the exponential digital filter of Xie & Castro (2008): white noise
+ *  on a uniform (y, z) grid is filtered with precomputed coefficients
+ *  \f$b_k \propto \exp(-2 |k| \Delta / L)\f$ in both directions, which
+ *  yields an integral length scale of L. The result is correlated in time
+ *  with an integral time scale T through the incremental update
+ *
+ *  \f[
+ *  \psi^{n+1} = \psi^n \exp\left(-\frac{\Delta t}{T}\right) +
+ *  \psi_{filt} \sqrt{1 - \exp\left(-\frac{2 \Delta t}{T}\right)}
+ *  \f]
+ *
+ *  The three components have zero mean and unit variance. The white noise is
+ *  a hash of the seed, the step and the grid index, i.e., every rank
+ *  generates the identical plane without communication.
+ */
+class DigitalFilterTurbulence
+{
+public:
+  //! Fluctuations indexed by (component, j, k)
+  using PlaneType = Kokkos::View<double***, Kokkos::LayoutRight, MemSpace>;
+  using ArrayType = Kokkos::View<double*, Kokkos::LayoutRight, MemSpace>;
+
+  //! Bilinear interpolation of the fluctuations; copyable to the device
+  struct Sampler
+  {
+    PlaneType psi;
+    double yMin;
+    double zMin;
+    double invDelta;
+    int ny;
+    int nz;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const double y, const double z, double* out) const
+    {
+      // clamp to the plane, the last cell is used for the upper edge
+      double sy = (y - yMin) * invDelta;
+      double sz = (z - zMin) * invDelta;
+      sy = (sy < 0.0) ? 0.0 : ((sy > ny - 1) ? ny - 1 : sy);
+      sz = (sz < 0.0) ? 0.0 : ((sz > nz - 1) ? nz - 1 : sz);
+      int j = static_cast<int>(sy);
+      int k = static_cast<int>(sz);
+      j = (j > ny - 2) ? ny - 2 : j;
+      k = (k > nz - 2) ? nz - 2 : k;
+      const double fy = sy - j;
+      const double fz = sz - k;
+
+      for (int c = 0; c < 3; ++c)
+        out[c] = (1.0 - fy) * (1.0 - fz) * psi(c, j, k) +
+                 fy * (1.0 - fz) * psi(c, j + 1, k) +
+                 (1.0 - fy) * fz * psi(c, j, k + 1) +
+                 fy * fz * psi(c, j + 1, k + 1);
+    }
+  };
+
+  DigitalFilterTurbulence(
+    const double yMin,
+    const double zMin,
+    const double delta,
+    const int ny,
+    const int nz,
+    const double lengthY,
+    const double lengthZ,
+    const double timeScale,
+    const uint64_t seed);
+
+  /** Advance the fluctuations by a time step
+   *
+   *  The first call generates uncorrelated (in time) fluctuations and
+   *  ignores the time step.
+   */
+  void advance(const double dt);
+
+  const PlaneType& fluctuations() const { return psi_; }
+
+  Sampler sampler() const;
+
+  int num_steps() const { return step_; }
+
+  //! Normalized filter coefficients for an integral length of `length`
+  static std::vector<double>
+  filter_coefficients(const double length, const double delta);
+
+private:
+  const double yMin_;
+  const double zMin_;
+  const double delta_;
+  const int ny_;
+  const int nz_;
+  const double timeScale_;
+  const uint64_t seed_;
+
+  int halfWidthY_;
+  int halfWidthZ_;
+
+  ArrayType coeffY_;
+  ArrayType coeffZ_;
+
+  //! White noise padded by the filter half widths
+  PlaneType noise_;
+
+  //! Noise filtered in y only
+  PlaneType filtY_;
+
+  PlaneType psi_;
+
+  int step_{0};
+};
+
+/** Synthetic turbulence at inflow boundaries
+ *
+ *  Populates the velocity boundary field with a power law mean profile in x
+ *  (z is the vertical direction) plus digital filter fluctuations, removing
+ *  the need for a precursor simulation to drive the inflow. The fluctuations
+ *  are advanced once per time step.
+ *
+ *  Parameters: uRef, zRef, shear exponent, turbulence intensities (u, v, w),
+ *  integral length scales (x, y, z), plane extents (yMin, yMax, zMin, zMax),
+ *  grid spacing and random seed. The time scale of the temporal correlation
+ *  follows from Taylor's hypothesis, i.e., Lx / uRef.
+ */
+class SyntheticInflowTurbulenceAlg : public Algorithm
+{
+public:
+  SyntheticInflowTurbulenceAlg(
+    Realm& realm,
+    stk::mesh::Part* part,
+    VectorFieldType* bcField,
+    const std::vector<double>& params);
+
+  virtual ~SyntheticInflowTurbulenceAlg() = default;
+
+  virtual void execute() override;
+
+private:
+  static DigitalFilterTurbulence
+  make_generator(const std::vector<double>& params);
+
+  VectorFieldType* bcField_;
+  unsigned coordinates_{stk::mesh::InvalidOrdinal};
+
+  //! Constructed first; checks the parameters
+  DigitalFilterTurbulence generator_;
+
+  const double uRef_;
+  const double zRef_;
+  const double shearExp_;
+  double amplitude_[3];
+
+  bool initialized_{false};
+  double lastTime_{0.0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* SYNTHETICINFLOWTURBULENCE_H */
@@ -1137,7 +1137,11 @@ public:
       dwdx_(&meta_->declare_field<VectorFieldType>(
         stk::topology::NODE_RANK, "dwdx")),
       forcingComp_(&meta_->declare_field<VectorFieldType>(
-        stk::topology::NODE_RANK, "forcing_components"))
+        stk::topology::NODE_RANK, "forcing_components")),
+      forcingBasis_(&meta_->declare_field<VectorFieldType>(
+        stk::topology::NODE_RANK, "forcing_basis")),
+      forcingCoeff_(&meta_->declare_field<ScalarFieldType>(
+        stk::topology::NODE_RANK, "forcing_coefficient"))
   {
     stk::mesh::put_field_on_mesh(*tke_, meta_->universal_part(), 1, nullptr);
     stk::mesh::put_field_on_mesh(*sdr_, meta_->universal_part(), 1, nullptr);
@@ -1168,6 +1172,10 @@ public:
       *dwdx_, meta_->universal_part(), spatialDim_, nullptr);
     stk::mesh::put_field_on_mesh(
       *forcingComp_, meta_->universal_part(), spatialDim_, nullptr);
+    stk::mesh::put_field_on_mesh(
+      *forcingBasis_, meta_->universal_part(), spatialDim_, nullptr);
+    stk::mesh::put_field_on_mesh(
+      *forcingCoeff_, meta_->universal_part(), 1, nullptr);
   }
 
   virtual ~AMSKernelHex8Mesh() {}
@@ -1197,6 +1205,8 @@ public:
     stk::mesh::field_fill(0.0, *dkdx_);
     stk::mesh::field_fill(0.0, *dwdx_);
     stk::mesh::field_fill(0.0, *forcingComp_);
+    stk::mesh::field_fill(0.0, *forcingBasis_);
+    stk::mesh::field_fill(0.0, *forcingCoeff_);
   }
 
   ScalarFieldType* tke_{nullptr};
@@ -1216,6 +1226,8 @@ public:
   VectorFieldType* dkdx_{nullptr};
   VectorFieldType* dwdx_{nullptr};
   VectorFieldType* forcingComp_{nullptr};
+  VectorFieldType* forcingBasis_{nullptr};
+  ScalarFieldType* forcingCoeff_{nullptr};
 };
 
 /** Test Fixture for the hybrid turbulence Kernels